@@ -31,5 +31,6 @@ int main( int argc, char** argv )
 
   std::cout << "\n\nDONE!!!...." << std::endl; 
 
-  return 0;
+  // STEP 6: Fail if run regressed vs. previous run given with --compare-to
+  return ( executor.haveRegressions() ? 1 : 0 );
 }
@@ -12,6 +12,7 @@
 
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #include <iostream>
 
@@ -35,6 +36,21 @@ namespace apps
   ResReal_ptr fx1,fx2,fx3,fx4 ; \
   ResReal_ptr fy1,fy2,fy3,fy4 ;
 
+#define DEL_DOT_VEC_2D_DATA_SETUP_LAYOUT \
+  FIELD_PTR x(m_nodal, 4, 0); \
+  FIELD_PTR y(m_nodal, 4, 1); \
+  FIELD_PTR xdot(m_nodal, 4, 2); \
+  FIELD_PTR ydot(m_nodal, 4, 3); \
+  ResReal_ptr div = m_div; \
+\
+  const Real_type ptiny = m_ptiny; \
+  const Real_type half = m_half; \
+\
+  FIELD_PTR x1,x2,x3,x4 ; \
+  FIELD_PTR y1,y2,y3,y4 ; \
+  FIELD_PTR fx1,fx2,fx3,fx4 ; \
+  FIELD_PTR fy1,fy2,fy3,fy4 ;
+
 
 DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
   : KernelBase(rajaperf::Apps_DEL_DOT_VEC_2D, params)
@@ -45,6 +61,14 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
   m_domain = new ADomain(getRunSize(), /* ndims = */ 2);
 
   m_array_length = m_domain->nnalls;
+
+  m_nodal = 0;
+  setDataLayoutsDefined();
+
+#if defined(RUN_THREADPOOL)
+  setVariantDefined(Base_ThreadPool);
+  setVariantDefined(Lambda_ThreadPool);
+#endif
 }
 
 DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D() 
@@ -57,6 +81,19 @@ Index_type DEL_DOT_VEC_2D::getItsPerRep() const
   return m_domain->n_real_zones;
 }
 
+Index_type DEL_DOT_VEC_2D::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_domain->n_real_zones +
+         (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_domain->n_real_zones +
+         (0*sizeof(Real_type) + 4*sizeof(Real_type)) *
+           (m_domain->imax+1 - m_domain->imin) * (m_domain->jmax+1 - m_domain->jmin);
+}
+
+Index_type DEL_DOT_VEC_2D::getFLOPsPerRep() const
+{
+  return 54 * m_domain->n_real_zones;
+}
+
 void DEL_DOT_VEC_2D::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
@@ -69,18 +106,138 @@ void DEL_DOT_VEC_2D::setUp(VariantID vid)
   allocAndInitData(m_xdot, m_array_length, vid);
   allocAndInitData(m_ydot, m_array_length, vid);
 
+  if ( getDataLayout(vid) != SoA ) {
+    const Real_ptr fields[] = { m_x, m_y, m_xdot, m_ydot };
+    allocAndPackData(m_nodal, fields, 4, m_array_length, 
+                     getDataLayout(vid), vid);
+  }
+
   allocAndInitDataConst(m_div, m_array_length, 0.0, vid);
 
   m_ptiny = 1.0e-20;
   m_half = 0.5;
 }
 
+//
+// Sequential and OpenMP variants with x, y, xdot, ydot in AoS or AoSoA 
+// layout (FIELD_PTR is LayoutReal_ptr for the layout).
+//
+template <typename FIELD_PTR>
+void DEL_DOT_VEC_2D::runDataLayoutVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_DATA_SETUP_LAYOUT;
+  DEL_DOT_VEC_2D_DATA_INDEX;
+
+  NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+  NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+  NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+#if defined(RUN_RAJA_SEQ)     
+    case RAJA_Seq : {
+
+      RAJA::ListSegment zones(m_domain->real_zones, m_domain->n_real_zones);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(zones, [=](Index_type i) {
+          DEL_DOT_VEC_2D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for 
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      RAJA::ListSegment zones(m_domain->real_zones, m_domain->n_real_zones);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(zones, [=](Index_type i) { 
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  DEL_DOT_VEC_2D : Unknown data layout variant id = " 
+                << vid << std::endl;
+    }
+
+  }
+}
+
 void DEL_DOT_VEC_2D::runKernel(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
+  switch ( getDataLayout(vid) ) {
+    case AoS : {
+      runDataLayoutVariant< LayoutReal_ptr<AoS> >(vid);
+      return;
+    }
+    case AoSoA : {
+      runDataLayoutVariant< LayoutReal_ptr<AoSoA> >(vid);
+      return;
+    }
+    default : {
+      break;
+    }
+  }
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -184,6 +341,59 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_THREADPOOL)
+    case Base_ThreadPool : {
+
+      DEL_DOT_VEC_2D_DATA_SETUP_CPU;
+      DEL_DOT_VEC_2D_DATA_INDEX;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForallChunks(ibegin, iend,
+          [=](Index_type ib, Index_type ie) {
+          for (Index_type ii = ib; ii < ie; ++ii ) {
+            DEL_DOT_VEC_2D_BODY_INDEX;
+            DEL_DOT_VEC_2D_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      DEL_DOT_VEC_2D_DATA_SETUP_CPU;
+      DEL_DOT_VEC_2D_DATA_INDEX;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForall(ibegin, iend, [=](Index_type ii) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_THREADPOOL
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -223,6 +433,7 @@ void DEL_DOT_VEC_2D::tearDown(VariantID vid)
   deallocData(m_xdot);
   deallocData(m_ydot);
   deallocData(m_div);
+  deallocData(m_nodal);
 }
 
 } // end namespace apps
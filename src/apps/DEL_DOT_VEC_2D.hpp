@@ -92,6 +92,8 @@ public:
   ~DEL_DOT_VEC_2D();
 
   Index_type getItsPerRep() const;
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -102,12 +104,17 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template <typename FIELD_PTR>
+  void runDataLayoutVariant(VariantID vid);
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_xdot;
   Real_ptr m_ydot;
   Real_ptr m_div;
 
+  Real_ptr m_nodal;  // x, y, xdot, ydot packed in AoS or AoSoA layout
+
   Real_type m_ptiny;
   Real_type m_half;
 
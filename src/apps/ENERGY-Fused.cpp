@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ENERGY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_FUSED)
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace apps
+{
+
+#define ENERGY_DATA_SETUP_FUSED \
+  ResReal_ptr e_new = m_e_new; \
+  ResReal_ptr e_old = m_e_old; \
+  ResReal_ptr delvc = m_delvc; \
+  ResReal_ptr p_new = m_p_new; \
+  ResReal_ptr p_old = m_p_old; \
+  ResReal_ptr q_new = m_q_new; \
+  ResReal_ptr q_old = m_q_old; \
+  ResReal_ptr work = m_work; \
+  ResReal_ptr compHalfStep = m_compHalfStep; \
+  ResReal_ptr pHalfStep = m_pHalfStep; \
+  ResReal_ptr bvc = m_bvc; \
+  ResReal_ptr pbvc = m_pbvc; \
+  ResReal_ptr ql_old = m_ql_old; \
+  ResReal_ptr qq_old = m_qq_old; \
+  ResReal_ptr vnewc = m_vnewc; \
+  const Real_type rho0 = m_rho0; \
+  const Real_type e_cut = m_e_cut; \
+  const Real_type emin = m_emin; \
+  const Real_type q_cut = m_q_cut;
+
+
+//
+// Each of the six loops reads and writes only index i of each array, so
+// running all six bodies for each i in one loop computes the same values 
+// with one pass over the 15 arrays instead of six.
+//
+Index_type ENERGY::getFusedBytesPerRep() const
+{
+  return (2*sizeof(Real_type) + 13*sizeof(Real_type)) * getRunSize();
+}
+
+template < typename EXEC_POL >
+using EnergyFusedPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<0, EXEC_POL,
+      RAJA::statement::Lambda<0>,
+      RAJA::statement::Lambda<1>,
+      RAJA::statement::Lambda<2>,
+      RAJA::statement::Lambda<3>,
+      RAJA::statement::Lambda<4>,
+      RAJA::statement::Lambda<5>
+    >
+  >;
+
+void ENERGY::runFusedVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getRunSize();
+
+  ENERGY_DATA_SETUP_FUSED;
+
+  auto energy_fused_lam1 = [=](Index_type i) {
+                             ENERGY_BODY1;
+                           };
+  auto energy_fused_lam2 = [=](Index_type i) {
+                             ENERGY_BODY2;
+                           };
+  auto energy_fused_lam3 = [=](Index_type i) {
+                             ENERGY_BODY3;
+                           };
+  auto energy_fused_lam4 = [=](Index_type i) {
+                             ENERGY_BODY4;
+                           };
+  auto energy_fused_lam5 = [=](Index_type i) {
+                             ENERGY_BODY5;
+                           };
+  auto energy_fused_lam6 = [=](Index_type i) {
+                             ENERGY_BODY6;
+                           };
+
+  switch ( vid ) {
+
+    case Base_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+          ENERGY_BODY2;
+          ENERGY_BODY3;
+          ENERGY_BODY4;
+          ENERGY_BODY5;
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EnergyFusedPolicy<RAJA::loop_exec>>(
+          RAJA::make_tuple(RAJA::RangeSegment(ibegin, iend)),
+          energy_fused_lam1,
+          energy_fused_lam2,
+          energy_fused_lam3,
+          energy_fused_lam4,
+          energy_fused_lam5,
+          energy_fused_lam6
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+          ENERGY_BODY2;
+          ENERGY_BODY3;
+          ENERGY_BODY4;
+          ENERGY_BODY5;
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EnergyFusedPolicy<RAJA::omp_parallel_for_exec>>(
+          RAJA::make_tuple(RAJA::RangeSegment(ibegin, iend)),
+          energy_fused_lam1,
+          energy_fused_lam2,
+          energy_fused_lam3,
+          energy_fused_lam4,
+          energy_fused_lam5,
+          energy_fused_lam6
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  ENERGY : Unknown fused variant id = " << vid 
+                << std::endl;
+    }
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RUN_FUSED
@@ -40,18 +40,61 @@ namespace apps
   const Real_type emin = m_emin; \
   const Real_type q_cut = m_q_cut;
 
+#define ENERGY_DATA_SETUP_LAYOUT \
+  FIELD_PTR e_new(m_zonal, 15, 0); \
+  FIELD_PTR e_old(m_zonal, 15, 1); \
+  FIELD_PTR delvc(m_zonal, 15, 2); \
+  FIELD_PTR p_new(m_zonal, 15, 3); \
+  FIELD_PTR p_old(m_zonal, 15, 4); \
+  FIELD_PTR q_new(m_zonal, 15, 5); \
+  FIELD_PTR q_old(m_zonal, 15, 6); \
+  FIELD_PTR work(m_zonal, 15, 7); \
+  FIELD_PTR compHalfStep(m_zonal, 15, 8); \
+  FIELD_PTR pHalfStep(m_zonal, 15, 9); \
+  FIELD_PTR bvc(m_zonal, 15, 10); \
+  FIELD_PTR pbvc(m_zonal, 15, 11); \
+  FIELD_PTR ql_old(m_zonal, 15, 12); \
+  FIELD_PTR qq_old(m_zonal, 15, 13); \
+  FIELD_PTR vnewc(m_zonal, 15, 14); \
+  const Real_type rho0 = m_rho0; \
+  const Real_type e_cut = m_e_cut; \
+  const Real_type emin = m_emin; \
+  const Real_type q_cut = m_q_cut;
+
 
 ENERGY::ENERGY(const RunParams& params)
   : KernelBase(rajaperf::Apps_ENERGY, params)
 {
   setDefaultSize(100000);
   setDefaultReps(1300);
+
+  m_zonal = 0;
+  setDataLayoutsDefined();
+
+#if defined(RUN_FUSED)
+  setVariantDefined(Base_Seq_Fused);
+  setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_Fused);
+  setVariantDefined(RAJA_OpenMP_Fused);
+#endif
+#endif
 }
 
 ENERGY::~ENERGY() 
 {
 }
 
+Index_type ENERGY::getBytesPerRep() const
+{
+  return (6*sizeof(Real_type) + 41*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type ENERGY::getFLOPsPerRep() const
+{
+  return (6 + 11 + 8 + 2 + 19 + 9) * getRunSize();
+}
+
 void ENERGY::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_e_new, getRunSize(), 0.0, vid);
@@ -74,6 +117,211 @@ void ENERGY::setUp(VariantID vid)
   initData(m_e_cut);
   initData(m_emin);
   initData(m_q_cut);
+
+  if ( getDataLayout(vid) != SoA ) {
+    const Real_ptr fields[] = { m_e_new, m_e_old, m_delvc, m_p_new,
+                                m_p_old, m_q_new, m_q_old, m_work,
+                                m_compHalfStep, m_pHalfStep, m_bvc, m_pbvc,
+                                m_ql_old, m_qq_old, m_vnewc };
+    allocAndPackData(m_zonal, fields, 15, getRunSize(), 
+                     getDataLayout(vid), vid);
+  }
+}
+
+//
+// Sequential and OpenMP variants with all arrays in AoS or AoSoA layout 
+// (FIELD_PTR is LayoutReal_ptr for the layout).
+//
+template <typename FIELD_PTR>
+void ENERGY::runDataLayoutVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getRunSize();
+
+  ENERGY_DATA_SETUP_LAYOUT;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+  
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+#if defined(RUN_RAJA_SEQ)     
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::seq_region>( [=]() {
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY1;
+          });
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY2;
+          }); 
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY3;
+          }); 
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY4;
+          }); 
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY5;
+          }); 
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY6;
+          }); 
+
+        }); // end sequential region (for single-source code)
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY1;
+          }
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY2;
+          }
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY3;
+          }
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY4;
+          }
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY5;
+          }
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY6;
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY1;
+          });
+
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY2;
+          });
+
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY3;
+          });
+  
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY4;
+          });
+  
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY5;
+          });
+  
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            ENERGY_BODY6;
+          });
+  
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  ENERGY : Unknown data layout variant id = " << vid 
+                << std::endl;
+    }
+
+  }
 }
 
 void ENERGY::runKernel(VariantID vid)
@@ -82,6 +330,20 @@ void ENERGY::runKernel(VariantID vid)
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
+  switch ( getDataLayout(vid) ) {
+    case AoS : {
+      runDataLayoutVariant< LayoutReal_ptr<AoS> >(vid);
+      return;
+    }
+    case AoSoA : {
+      runDataLayoutVariant< LayoutReal_ptr<AoSoA> >(vid);
+      return;
+    }
+    default : {
+      break;
+    }
+  }
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -265,6 +527,19 @@ void ENERGY::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_FUSED)
+    case Base_Seq_Fused :
+    case RAJA_Seq_Fused :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused :
+    case RAJA_OpenMP_Fused :
+#endif
+    {
+      runFusedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -292,6 +567,11 @@ void ENERGY::runKernel(VariantID vid)
 
 void ENERGY::updateChecksum(VariantID vid)
 {
+  if ( getDataLayout(vid) != SoA ) {
+    unpackData(m_e_new, m_zonal, 15, 0, getRunSize(), getDataLayout(vid));
+    unpackData(m_q_new, m_zonal, 15, 5, getRunSize(), getDataLayout(vid));
+  }
+
   checksum[vid] += calcChecksum(m_e_new, getRunSize());
   checksum[vid] += calcChecksum(m_q_new, getRunSize());
 }
@@ -315,6 +595,7 @@ void ENERGY::tearDown(VariantID vid)
   deallocData(m_ql_old);
   deallocData(m_qq_old);
   deallocData(m_vnewc);
+  deallocData(m_zonal);
 }
 
 } // end namespace apps
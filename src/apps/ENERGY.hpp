@@ -174,6 +174,10 @@ public:
 
   ~ENERGY();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+  Index_type getFusedBytesPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -181,8 +185,12 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runFusedVariant(VariantID vid);
 
 private:
+  template <typename FIELD_PTR>
+  void runDataLayoutVariant(VariantID vid);
+
   Real_ptr m_e_new;
   Real_ptr m_e_old;
   Real_ptr m_delvc;
@@ -199,6 +207,8 @@ private:
   Real_ptr m_qq_old; 
   Real_ptr m_vnewc; 
 
+  Real_ptr m_zonal;  // arrays above packed in AoS or AoSoA layout
+
   Real_type m_rho0;
   Real_type m_e_cut;
   Real_type m_emin;
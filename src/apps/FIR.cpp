@@ -48,6 +48,18 @@ Index_type FIR::getItsPerRep() const {
   return getRunSize() - m_coefflen;
 }
 
+Index_type FIR::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getItsPerRep() +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getRunSize() +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_coefflen;
+}
+
+Index_type FIR::getFLOPsPerRep() const
+{
+  return (2 * m_coefflen) * getItsPerRep();
+}
+
 void FIR::setUp(VariantID vid)
 {
   allocAndInitData(m_in, getRunSize(), vid);
@@ -38,7 +38,7 @@
                                          -1.0, -1.0, -1.0, 3.0 };
 
 #define FIR_BODY \
-  Real_type sum = 0.0; \
+  Accum_type sum = 0.0; \
 \
   for (Index_type j = 0; j < coefflen; ++j ) { \
     sum += coeff[j]*in[i+j]; \
@@ -64,6 +64,8 @@ public:
   ~FIR();
 
   Index_type getItsPerRep() const;
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -42,14 +42,7 @@ LTIMES::LTIMES(const RunParams& params)
   setDefaultSize(m_num_d_default * m_num_m_default * 
                  m_num_g_default * m_num_z_default);
   setDefaultReps(50);
-}
-
-LTIMES::~LTIMES() 
-{
-}
 
-void LTIMES::setUp(VariantID vid)
-{
   m_num_z = run_params.getSizeFactor() * m_num_z_default;
   m_num_g = m_num_g_default;  
   m_num_m = m_num_m_default;  
@@ -58,7 +51,26 @@ void LTIMES::setUp(VariantID vid)
   m_philen = m_num_m * m_num_g * m_num_z;
   m_elllen = m_num_d * m_num_m;
   m_psilen = m_num_d * m_num_g * m_num_z;
+}
+
+LTIMES::~LTIMES() 
+{
+}
+
+Index_type LTIMES::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_philen +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_elllen +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_psilen;
+}
 
+Index_type LTIMES::getFLOPsPerRep() const
+{
+  return 2 * m_num_z * m_num_g * m_num_m * m_num_d;
+}
+
+void LTIMES::setUp(VariantID vid)
+{
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
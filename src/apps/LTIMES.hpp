@@ -98,6 +98,9 @@ public:
 
   ~LTIMES();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
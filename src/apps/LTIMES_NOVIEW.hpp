@@ -48,6 +48,9 @@ public:
 
   ~LTIMES_NOVIEW();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -42,6 +42,16 @@ PRESSURE::~PRESSURE()
 {
 }
 
+Index_type PRESSURE::getBytesPerRep() const
+{
+  return (2*sizeof(Real_type) + 4*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type PRESSURE::getFLOPsPerRep() const
+{
+  return 3 * getRunSize();
+}
+
 void PRESSURE::setUp(VariantID vid)
 {
   allocAndInitData(m_compression, getRunSize(), vid);
@@ -52,6 +52,9 @@ public:
 
   ~PRESSURE();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
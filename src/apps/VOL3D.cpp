@@ -12,6 +12,7 @@
 
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #include <iostream>
 
@@ -32,6 +33,18 @@ namespace apps
   Real_ptr y0,y1,y2,y3,y4,y5,y6,y7 ; \
   Real_ptr z0,z1,z2,z3,z4,z5,z6,z7 ;
 
+#define VOL3D_DATA_SETUP_LAYOUT \
+  FIELD_PTR x(m_xyz, 3, 0); \
+  FIELD_PTR y(m_xyz, 3, 1); \
+  FIELD_PTR z(m_xyz, 3, 2); \
+  ResReal_ptr vol = m_vol; \
+\
+  const Real_type vnormq = m_vnormq; \
+\
+  FIELD_PTR x0,x1,x2,x3,x4,x5,x6,x7 ; \
+  FIELD_PTR y0,y1,y2,y3,y4,y5,y6,y7 ; \
+  FIELD_PTR z0,z1,z2,z3,z4,z5,z6,z7 ;
+
 
 VOL3D::VOL3D(const RunParams& params)
   : KernelBase(rajaperf::Apps_VOL3D, params)
@@ -42,6 +55,14 @@ VOL3D::VOL3D(const RunParams& params)
   m_domain = new ADomain(getRunSize(), /* ndims = */ 3);
 
   m_array_length = m_domain->nnalls;;
+
+  m_xyz = 0;
+  setDataLayoutsDefined();
+
+#if defined(RUN_THREADPOOL)
+  setVariantDefined(Base_ThreadPool);
+  setVariantDefined(Lambda_ThreadPool);
+#endif
 }
 
 VOL3D::~VOL3D() 
@@ -53,6 +74,18 @@ Index_type VOL3D::getItsPerRep() const {
   return m_domain->lpz+1 - m_domain->fpz;
 }
 
+Index_type VOL3D::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getItsPerRep() +
+         (0*sizeof(Real_type) + 3*sizeof(Real_type)) *
+           (getItsPerRep() + 1 + m_domain->jp + m_domain->kp);
+}
+
+Index_type VOL3D::getFLOPsPerRep() const
+{
+  return 90 * getItsPerRep();
+}
+
 void VOL3D::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
@@ -64,17 +97,131 @@ void VOL3D::setUp(VariantID vid)
   Real_type dz = 0.1;
   setMeshPositions_3d(m_x, dx, m_y, dy, m_z, dz, *m_domain);
 
+  if ( getDataLayout(vid) != SoA ) {
+    const Real_ptr fields[] = { m_x, m_y, m_z };
+    allocAndPackData(m_xyz, fields, 3, m_array_length, 
+                     getDataLayout(vid), vid);
+  }
+
   allocAndInitDataConst(m_vol, m_array_length, 0.0, vid);
 
   m_vnormq = 0.083333333333333333; /* vnormq = 1/12 */  
 }
 
+//
+// Sequential and OpenMP variants with x, y, z in AoS or AoSoA layout 
+// (FIELD_PTR is LayoutReal_ptr for the layout).
+//
+template <typename FIELD_PTR>
+void VOL3D::runDataLayoutVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  VOL3D_DATA_SETUP_LAYOUT;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+  NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+  NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+#if defined(RUN_RAJA_SEQ)     
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for 
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  VOL3D : Unknown data layout variant id = " << vid 
+                << std::endl;
+    }
+
+  }
+}
+
 void VOL3D::runKernel(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = m_domain->fpz;
   const Index_type iend = m_domain->lpz+1;
 
+  switch ( getDataLayout(vid) ) {
+    case AoS : {
+      runDataLayoutVariant< LayoutReal_ptr<AoS> >(vid);
+      return;
+    }
+    case AoSoA : {
+      runDataLayoutVariant< LayoutReal_ptr<AoSoA> >(vid);
+      return;
+    }
+    default : {
+      break;
+    }
+  }
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -168,6 +315,53 @@ void VOL3D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_THREADPOOL)
+    case Base_ThreadPool : {
+
+      VOL3D_DATA_SETUP_CPU;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForallChunks(ibegin, iend,
+          [=](Index_type ib, Index_type ie) {
+          for (Index_type i = ib; i < ie; ++i ) {
+            VOL3D_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      VOL3D_DATA_SETUP_CPU;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForall(ibegin, iend, [=](Index_type i) {
+          VOL3D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_THREADPOOL
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -206,6 +400,7 @@ void VOL3D::tearDown(VariantID vid)
   deallocData(m_y);
   deallocData(m_z);
   deallocData(m_vol);
+  deallocData(m_xyz);
 }
 
 } // end namespace apps
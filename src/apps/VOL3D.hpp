@@ -150,6 +150,8 @@ public:
   ~VOL3D();
 
   Index_type getItsPerRep() const;
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -160,11 +162,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template <typename FIELD_PTR>
+  void runDataLayoutVariant(VariantID vid);
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_z;
   Real_ptr m_vol;
 
+  Real_ptr m_xyz;  // x, y, z packed in AoS or AoSoA layout
+
   Real_type m_vnormq;
 
   ADomain* m_domain;
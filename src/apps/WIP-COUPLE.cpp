@@ -67,6 +67,16 @@ Index_type COUPLE::getItsPerRep() const
   return  ( (m_imax - m_imin) * (m_jmax - m_jmin) * (m_kmax - m_kmin) ); 
 }
 
+Index_type COUPLE::getBytesPerRep() const
+{
+  return (3*sizeof(Complex_type) + 5*sizeof(Complex_type)) * getItsPerRep();
+}
+
+Index_type COUPLE::getFLOPsPerRep() const
+{
+  return 134 * getItsPerRep();
+}
+
 void COUPLE::setUp(VariantID vid)
 {
   int max_loop_index = m_domain->lrn;
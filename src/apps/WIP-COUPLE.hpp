@@ -143,6 +143,8 @@ public:
   ~COUPLE();
 
   Index_type getItsPerRep() const;
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
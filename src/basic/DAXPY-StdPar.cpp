@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "DAXPY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+#define DAXPY_DATA_SETUP_STDPAR \
+  ResReal_ptr x = m_x; \
+  ResReal_ptr y = m_y; \
+  Real_type a = m_a;
+
+
+void DAXPY::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getRunSize();
+
+  if ( vid == Base_StdPar ) {
+
+    DAXPY_DATA_SETUP_STDPAR;
+
+    const IndexIterator begin(ibegin);
+    const IndexIterator end(iend);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      std::for_each( std::execution::par_unseq, begin, end,
+        [=](Index_type i) {
+        DAXPY_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  DAXPY : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
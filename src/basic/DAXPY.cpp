@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #include <iostream>
 
@@ -25,18 +27,43 @@ namespace basic
   ResReal_ptr y = m_y; \
   Real_type a = m_a; 
 
+#define DAXPY_DATA_SETUP_SIMD \
+  const SIMDReal va = simdSet1(a);
+
 
 DAXPY::DAXPY(const RunParams& params)
   : KernelBase(rajaperf::Basic_DAXPY, params)
 {
    setDefaultSize(100000);
    setDefaultReps(5000);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_THREADPOOL)
+   setVariantDefined(Base_ThreadPool);
+   setVariantDefined(Lambda_ThreadPool);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 DAXPY::~DAXPY() 
 {
 }
 
+Index_type DAXPY::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type DAXPY::getFLOPsPerRep() const
+{
+  return 2 * getRunSize();
+}
+
 void DAXPY::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_y, getRunSize(), 0.0, vid);
@@ -89,6 +116,48 @@ void DAXPY::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      DAXPY_DATA_SETUP_CPU;
+      DAXPY_DATA_SETUP_SIMD;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          DAXPY_BODY_SIMD;
+        }
+        for ( ; i < iend; ++i ) {
+          DAXPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      DAXPY_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DAXPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
     case Base_OpenMP : {
 
@@ -127,6 +196,53 @@ void DAXPY::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_THREADPOOL)
+    case Base_ThreadPool : {
+
+      DAXPY_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForallChunks(ibegin, iend,
+          [=](Index_type ib, Index_type ie) {
+          for (Index_type i = ib; i < ie; ++i ) {
+            DAXPY_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      DAXPY_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForall(ibegin, iend, [=](Index_type i) {
+          DAXPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_THREADPOOL
+
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -22,6 +22,10 @@
   y[i] += a * x[i] ;
 
 
+#define DAXPY_BODY_SIMD  \
+  simdStore( &y[i], simdLoad(&y[i]) + va * simdLoad(&x[i]) ) ;
+
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf 
@@ -39,6 +43,9 @@ public:
 
   ~DAXPY();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -46,6 +53,7 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_ptr m_x;
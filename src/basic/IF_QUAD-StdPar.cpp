@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IF_QUAD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+#define IF_QUAD_DATA_SETUP_STDPAR \
+  ResReal_ptr a = m_a; \
+  ResReal_ptr b = m_b; \
+  ResReal_ptr c = m_c; \
+  ResReal_ptr x1 = m_x1; \
+  ResReal_ptr x2 = m_x2;
+
+
+void IF_QUAD::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getRunSize();
+
+  if ( vid == Base_StdPar ) {
+
+    IF_QUAD_DATA_SETUP_STDPAR;
+
+    const IndexIterator begin(ibegin);
+    const IndexIterator end(iend);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      std::for_each( std::execution::par_unseq, begin, end,
+        [=](Index_type i) {
+        IF_QUAD_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  IF_QUAD : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #include <iostream>
 
@@ -33,12 +35,34 @@ IF_QUAD::IF_QUAD(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(1800);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_THREADPOOL)
+   setVariantDefined(Base_ThreadPool);
+   setVariantDefined(Lambda_ThreadPool);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 IF_QUAD::~IF_QUAD() 
 {
 }
 
+Index_type IF_QUAD::getBytesPerRep() const
+{
+  return (2*sizeof(Real_type) + 3*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type IF_QUAD::getFLOPsPerRep() const
+{
+  return 11 * getRunSize();
+}
+
 void IF_QUAD::setUp(VariantID vid)
 {
   allocAndInitDataRandSign(m_a, getRunSize(), vid);
@@ -92,6 +116,47 @@ void IF_QUAD::runKernel(VariantID vid)
     }
 #endif // RUN_RAJA_SEQ
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      IF_QUAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          IF_QUAD_BODY_SIMD;
+        }
+        for ( ; i < iend; ++i ) {
+          IF_QUAD_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      IF_QUAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          IF_QUAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
     case Base_OpenMP : {
 
@@ -131,6 +196,53 @@ void IF_QUAD::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_THREADPOOL)
+    case Base_ThreadPool : {
+
+      IF_QUAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForallChunks(ibegin, iend,
+          [=](Index_type ib, Index_type ie) {
+          for (Index_type i = ib; i < ie; ++i ) {
+            IF_QUAD_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      IF_QUAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForall(ibegin, iend, [=](Index_type i) {
+          IF_QUAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_THREADPOOL
+
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
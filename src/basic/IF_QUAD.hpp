@@ -40,6 +40,18 @@
   }
 
 
+#define IF_QUAD_BODY_SIMD  \
+  SIMDReal va = simdLoad(&a[i]); \
+  SIMDReal vb = simdLoad(&b[i]); \
+  SIMDReal vs = vb*vb - simdSet1(4.0)*va*simdLoad(&c[i]); \
+  SIMDReal vsq = simdSqrt(vs); \
+  SIMDReal vzero = simdSet1(0.0); \
+  simdStore( &x2[i], simdSelectNonNeg(vs, \
+    (vzero-vb+vsq)/(simdSet1(2.0)*va), vzero) ); \
+  simdStore( &x1[i], simdSelectNonNeg(vs, \
+    (vzero-vb-vsq)/(simdSet1(2.0)*va), vzero) );
+
+
 namespace rajaperf 
 {
 class RunParams;
@@ -55,6 +67,9 @@ public:
 
   ~IF_QUAD();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -62,6 +77,7 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_ptr m_a;
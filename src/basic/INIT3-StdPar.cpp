@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "INIT3.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+#define INIT3_DATA_SETUP_STDPAR \
+  ResReal_ptr out1 = m_out1; \
+  ResReal_ptr out2 = m_out2; \
+  ResReal_ptr out3 = m_out3; \
+  ResReal_ptr in1 = m_in1; \
+  ResReal_ptr in2 = m_in2;
+
+
+void INIT3::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getRunSize();
+
+  if ( vid == Base_StdPar ) {
+
+    INIT3_DATA_SETUP_STDPAR;
+
+    const IndexIterator begin(ibegin);
+    const IndexIterator end(iend);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      std::for_each( std::execution::par_unseq, begin, end,
+        [=](Index_type i) {
+        INIT3_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  INIT3 : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
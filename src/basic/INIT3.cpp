@@ -33,12 +33,26 @@ INIT3::INIT3(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(5000);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 INIT3::~INIT3() 
 {
 }
 
+Index_type INIT3::getBytesPerRep() const
+{
+  return (3*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type INIT3::getFLOPsPerRep() const
+{
+  return 1 * getRunSize();
+}
+
 void INIT3::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_out1, getRunSize(), 0.0, vid);
@@ -131,6 +145,14 @@ void INIT3::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -0,0 +1,61 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "INIT_VIEW1D_OFFSET.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+#define INIT_VIEW1D_OFFSET_DATA_SETUP_STDPAR \
+  Real_ptr a = m_a; \
+  const Real_type v = m_val;
+
+
+void INIT_VIEW1D_OFFSET::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = getRunSize()+1;
+
+  if ( vid == Base_StdPar ) {
+
+    INIT_VIEW1D_OFFSET_DATA_SETUP_STDPAR;
+
+    const IndexIterator begin(ibegin);
+    const IndexIterator end(iend);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      std::for_each( std::execution::par_unseq, begin, end,
+        [=](Index_type i) {
+        INIT_VIEW1D_OFFSET_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  INIT_VIEW1D_OFFSET : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
@@ -36,12 +36,26 @@ INIT_VIEW1D_OFFSET::INIT_VIEW1D_OFFSET(const RunParams& params)
 {
    setDefaultSize(500000);
    setDefaultReps(5000);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 INIT_VIEW1D_OFFSET::~INIT_VIEW1D_OFFSET() 
 {
 }
 
+Index_type INIT_VIEW1D_OFFSET::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type INIT_VIEW1D_OFFSET::getFLOPsPerRep() const
+{
+  return 0;
+}
+
 void INIT_VIEW1D_OFFSET::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_a, getRunSize(), 0.0, vid);
@@ -131,6 +145,14 @@ void INIT_VIEW1D_OFFSET::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -33,12 +33,26 @@ MULADDSUB::MULADDSUB(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(3500);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 MULADDSUB::~MULADDSUB() 
 {
 }
 
+Index_type MULADDSUB::getBytesPerRep() const
+{
+  return (3*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type MULADDSUB::getFLOPsPerRep() const
+{
+  return 3 * getRunSize();
+}
+
 void MULADDSUB::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_out1, getRunSize(), 0.0, vid);
@@ -131,6 +145,14 @@ void MULADDSUB::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
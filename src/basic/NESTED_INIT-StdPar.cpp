@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "NESTED_INIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+#define NESTED_INIT_DATA_SETUP_STDPAR \
+  ResReal_ptr array = m_array; \
+  Index_type ni = m_ni; \
+  Index_type nj = m_nj; \
+  Index_type nk = m_nk;
+
+
+void NESTED_INIT::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  if ( vid == Base_StdPar ) {
+
+    NESTED_INIT_DATA_SETUP_STDPAR;
+
+    const IndexIterator kbegin(0);
+    const IndexIterator kend(nk);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      std::for_each( std::execution::par_unseq, kbegin, kend,
+        [=](Index_type k) {
+        for (Index_type j = 0; j < nj; ++j ) {
+          for (Index_type i = 0; i < ni; ++i ) {
+            NESTED_INIT_BODY;
+          }
+        }
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  NESTED_INIT : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
@@ -36,17 +36,31 @@ NESTED_INIT::NESTED_INIT(const RunParams& params)
 
   setDefaultSize(m_ni * m_nj * m_nk);
   setDefaultReps(100);
+
+  m_nk = m_nk_init * static_cast<Real_type>( getRunSize() ) / getDefaultSize();
+  m_array_length = m_ni * m_nj * m_nk;
+
+#if defined(RUN_STDPAR)
+  setVariantDefined(Base_StdPar);
+#endif
 }
 
 NESTED_INIT::~NESTED_INIT() 
 {
 }
 
-void NESTED_INIT::setUp(VariantID vid)
+Index_type NESTED_INIT::getBytesPerRep() const
 {
-  m_nk = m_nk_init * static_cast<Real_type>( getRunSize() ) / getDefaultSize();
-  m_array_length = m_ni * m_nj * m_nk;
+  return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_array_length;
+}
 
+Index_type NESTED_INIT::getFLOPsPerRep() const
+{
+  return 3 * m_array_length;
+}
+
+void NESTED_INIT::setUp(VariantID vid)
+{
   allocAndInitDataConst(m_array, m_array_length, 0.0, vid);
 }
 
@@ -181,6 +195,14 @@ void NESTED_INIT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -215,8 +237,7 @@ void NESTED_INIT::updateChecksum(VariantID vid)
 void NESTED_INIT::tearDown(VariantID vid)
 {
   (void) vid;
-  RAJA::free_aligned(m_array);
-  m_array = 0; 
+  deallocData(m_array);
 }
 
 } // end namespace basic
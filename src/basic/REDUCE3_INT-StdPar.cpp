@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE3_INT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+//
+// Sum, min, and max of vector values, combined by parallel reduction.
+//
+struct Reduce3IntValues
+{
+  Int_type vsum;
+  Int_type vmin;
+  Int_type vmax;
+};
+
+static Reduce3IntValues combineReduce3IntValues(const Reduce3IntValues& a,
+                                                const Reduce3IntValues& b)
+{
+  const Reduce3IntValues v = { a.vsum + b.vsum, 
+                               RAJA_MIN(a.vmin, b.vmin),
+                               RAJA_MAX(a.vmax, b.vmax) };
+  return v;
+}
+
+#define REDUCE3_INT_DATA_SETUP_STDPAR \
+  Int_ptr vec = m_vec;
+
+
+void REDUCE3_INT::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getRunSize();
+
+  if ( vid == Base_StdPar ) {
+
+    REDUCE3_INT_DATA_SETUP_STDPAR;
+
+    const IndexIterator begin(ibegin);
+    const IndexIterator end(iend);
+
+    const Int_type vmin_init = m_vmin_init;
+    const Int_type vmax_init = m_vmax_init;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const Reduce3IntValues init = { m_vsum_init, m_vmin_init, m_vmax_init };
+
+      const Reduce3IntValues vals = 
+        std::transform_reduce( std::execution::par_unseq, begin, end,
+          init, combineReduce3IntValues,
+          [=](Index_type i) {
+            Int_type vsum = 0;
+            Int_type vmin = vmin_init;
+            Int_type vmax = vmax_init;
+            REDUCE3_INT_BODY;
+            const Reduce3IntValues v = { vsum, vmin, vmax };
+            return v;
+          });
+
+      m_vsum += vals.vsum;
+      m_vmin = RAJA_MIN(m_vmin, vals.vmin);
+      m_vmax = RAJA_MAX(m_vmax, vals.vmax);
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  REDUCE3_INT : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
@@ -33,12 +33,27 @@ REDUCE3_INT::REDUCE3_INT(const RunParams& params)
 // Set reps to low value until we resolve RAJA omp-target 
 // reduction performance issues
    setDefaultReps(100);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 REDUCE3_INT::~REDUCE3_INT() 
 {
 }
 
+Index_type REDUCE3_INT::getBytesPerRep() const
+{
+  return (3*sizeof(Int_type) + 3*sizeof(Int_type)) +
+         (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getRunSize();
+}
+
+Index_type REDUCE3_INT::getFLOPsPerRep() const
+{
+  return 0;
+}
+
 void REDUCE3_INT::setUp(VariantID vid)
 {
   allocAndInitData(m_vec, getRunSize(), vid);
@@ -168,6 +183,14 @@ void REDUCE3_INT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -136,14 +136,14 @@ void TRAP_INT::runCudaVariant(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> sumx(m_sumx_init);
+      RAJA::ReduceSum<RAJA::cuda_reduce, Accum_type> sumx(m_sumx_init);
 
       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         TRAP_INT_BODY;
       });
 
-      m_sumx += static_cast<Real_type>(sumx.get()) * h;
+      m_sumx += static_cast<Accum_type>(sumx.get()) * h;
 
     }
     stopTimer();
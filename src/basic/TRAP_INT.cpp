@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
 
 #include <iostream>
 
@@ -33,6 +34,19 @@ Real_type trap_int_func(Real_type x,
    return denom;
 }
 
+#if defined(RUN_SIMD)
+RAJA_INLINE
+SIMDReal trap_int_func(SIMDReal x,
+                       SIMDReal y,
+                       SIMDReal xp,
+                       SIMDReal yp)
+{
+   SIMDReal denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = simdSet1(1.0)/simdSqrt(denom);
+   return denom;
+}
+#endif
+
 
 #define TRAP_INT_DATA_SETUP_CPU \
   Real_type x0 = m_x0; \
@@ -41,18 +55,45 @@ Real_type trap_int_func(Real_type x,
   Real_type yp = m_yp; \
   Real_type h = m_h;
 
+#define TRAP_INT_DATA_SETUP_SIMD \
+  const SIMDReal vx0 = simdSet1(x0); \
+  const SIMDReal vxp = simdSet1(xp); \
+  const SIMDReal vy = simdSet1(y); \
+  const SIMDReal vyp = simdSet1(yp); \
+  const SIMDReal vh = simdSet1(h); \
+  const SIMDReal vstep = simdSet1(simd_width);
+
 
 TRAP_INT::TRAP_INT(const RunParams& params)
   : KernelBase(rajaperf::Basic_TRAP_INT, params)
 {
    setDefaultSize(100000);
    setDefaultReps(2000);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 TRAP_INT::~TRAP_INT() 
 {
 }
 
+Index_type TRAP_INT::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
+         (0*sizeof(Real_type) + 0*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type TRAP_INT::getFLOPsPerRep() const
+{
+  return 10 * getRunSize();
+}
+
 void TRAP_INT::setUp(VariantID vid)
 {
   Real_type xn; 
@@ -85,7 +126,7 @@ void TRAP_INT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sumx = m_sumx_init;
+        Accum_type sumx = m_sumx_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           TRAP_INT_BODY;
@@ -107,14 +148,14 @@ void TRAP_INT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sumx(m_sumx_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Accum_type> sumx(m_sumx_init);
 
         RAJA::forall<RAJA::loop_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](int i) {
           TRAP_INT_BODY;
         });
 
-        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+        m_sumx += static_cast<Accum_type>(sumx.get()) * h;
 
       }
       stopTimer();
@@ -123,6 +164,59 @@ void TRAP_INT::runKernel(VariantID vid)
     }
 #endif // RUN_RAJA_SEQ
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      TRAP_INT_DATA_SETUP_CPU;
+      TRAP_INT_DATA_SETUP_SIMD;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Accum_type sumx = m_sumx_init;
+
+        SIMDReal vsumx = simdSet1(0.0);
+        SIMDReal vi = simdIota(ibegin);
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          TRAP_INT_BODY_SIMD;
+        }
+        simdAddTo(sumx, vsumx);
+        for ( ; i < iend; ++i ) {
+          TRAP_INT_BODY;
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      TRAP_INT_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Accum_type> sumx(m_sumx_init);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRAP_INT_BODY;
+        });
+
+        m_sumx += static_cast<Accum_type>(sumx.get()) * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
     case Base_OpenMP : {
 
@@ -131,7 +225,7 @@ void TRAP_INT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sumx = m_sumx_init;
+        Accum_type sumx = m_sumx_init;
 
         #pragma omp parallel for reduction(+:sumx)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -153,14 +247,14 @@ void TRAP_INT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sumx(m_sumx_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Accum_type> sumx(m_sumx_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           TRAP_INT_BODY;
         });
 
-        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+        m_sumx += static_cast<Accum_type>(sumx.get()) * h;
 
       }
       stopTimer();
@@ -169,6 +263,14 @@ void TRAP_INT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
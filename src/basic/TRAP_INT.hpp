@@ -34,6 +34,12 @@
   sumx += trap_int_func(x, y, xp, yp);
 
 
+#define TRAP_INT_BODY_SIMD \
+  SIMDReal vx = vx0 + vi*vh; \
+  vsumx = vsumx + trap_int_func(vx, vy, vxp, vyp); \
+  vi = vi + vstep;
+
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf 
@@ -51,6 +57,9 @@ public:
 
   ~TRAP_INT();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -58,6 +67,7 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_type m_x0;
@@ -67,7 +77,7 @@ private:
   Real_type m_h;
   Real_type m_sumx_init;
 
-  Real_type m_sumx;
+  Accum_type m_sumx;
 };
 
 } // end namespace basic
@@ -0,0 +1,281 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BaselineRun.hpp"
+
+#include <cstdlib>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+#include <sys/stat.h>
+
+namespace rajaperf
+{
+
+const BaselineKernel* BaselineRun::findKernel(const std::string& name) const
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    if ( kernels[ik].name == name ) {
+      return &kernels[ik];
+    }
+  }
+  return 0;
+}
+
+
+/*
+ * Minimal recursive descent JSON reader. It tracks the path of object keys
+ * and array indices to each value and passes scalar values with their path
+ * to the baseline run data, which keeps the ones it needs.
+ */
+class BaselineJSONReader
+{
+public:
+  BaselineJSONReader(const std::string& text, BaselineRun& baseline)
+    : m_text(text), m_pos(0), m_baseline(baseline) { ; }
+
+  bool read()
+  {
+    if ( !parseValue() ) {
+      return false;
+    }
+    skipSpace();
+    return m_pos == m_text.size();
+  }
+
+  size_t position() const { return m_pos; }
+
+private:
+  void skipSpace()
+  {
+    while ( m_pos < m_text.size() &&
+            std::isspace( static_cast<unsigned char>(m_text[m_pos]) ) ) {
+      ++m_pos;
+    }
+  }
+
+  bool match(char c)
+  {
+    skipSpace();
+    if ( m_pos < m_text.size() && m_text[m_pos] == c ) {
+      ++m_pos;
+      return true;
+    }
+    return false;
+  }
+
+  bool parseValue()
+  {
+    skipSpace();
+    if ( m_pos >= m_text.size() ) {
+      return false;
+    }
+
+    char c = m_text[m_pos];
+    if ( c == '{' ) {
+      return parseObject();
+    } else if ( c == '[' ) {
+      return parseArray();
+    } else if ( c == '"' ) {
+      std::string str;
+      if ( !parseString(str) ) {
+        return false;
+      }
+      setString(str);
+      return true;
+    } else if ( c == 't' || c == 'f' || c == 'n' ) {
+      const char* literals[] = { "true", "false", "null" };
+      for (int il = 0; il < 3; ++il) {
+        std::string lit(literals[il]);
+        if ( m_text.compare(m_pos, lit.size(), lit) == 0 ) {
+          m_pos += lit.size();
+          return true;
+        }
+      }
+      return false;
+    }
+
+    const char* begin = m_text.c_str() + m_pos;
+    char* end = 0;
+    double val = std::strtod(begin, &end);
+    if ( end == begin ) {
+      return false;
+    }
+    m_pos += static_cast<size_t>(end - begin);
+    setNumber(val);
+    return true;
+  }
+
+  bool parseObject()
+  {
+    ++m_pos;  // '{'
+    if ( match('}') ) {
+      return true;
+    }
+    do {
+      skipSpace();
+      std::string key;
+      if ( !parseString(key) || !match(':') ) {
+        return false;
+      }
+      m_path.push_back(key);
+      bool ok = parseValue();
+      m_path.pop_back();
+      if ( !ok ) {
+        return false;
+      }
+    } while ( match(',') );
+    return match('}');
+  }
+
+  bool parseArray()
+  {
+    ++m_pos;  // '['
+    if ( match(']') ) {
+      return true;
+    }
+    size_t index = 0;
+    do {
+      std::ostringstream idx;
+      idx << index++;
+      m_path.push_back(idx.str());
+      bool ok = parseValue();
+      m_path.pop_back();
+      if ( !ok ) {
+        return false;
+      }
+    } while ( match(',') );
+    return match(']');
+  }
+
+  bool parseString(std::string& str)
+  {
+    if ( m_pos >= m_text.size() || m_text[m_pos] != '"' ) {
+      return false;
+    }
+    ++m_pos;
+    while ( m_pos < m_text.size() && m_text[m_pos] != '"' ) {
+      char c = m_text[m_pos++];
+      if ( c == '\\' && m_pos < m_text.size() ) {
+        char e = m_text[m_pos++];
+        switch ( e ) {
+          case 'b' : c = '\b'; break;
+          case 'f' : c = '\f'; break;
+          case 'n' : c = '\n'; break;
+          case 'r' : c = '\r'; break;
+          case 't' : c = '\t'; break;
+          case 'u' : {
+            // Names in report files are ASCII; keep low byte only
+            c = static_cast<char>( std::strtol(
+                  m_text.substr(m_pos, 4).c_str(), 0, 16) );
+            m_pos += 4;
+            break;
+          }
+          default : c = e;
+        }
+      }
+      str += c;
+    }
+    return match('"');
+  }
+
+  //
+  // Methods to keep values needed for baseline at their path in file.
+  //
+  BaselineKernel* kernelAtPath()
+  {
+    if ( m_path.size() < 3 || m_path[0] != "kernels" ) {
+      return 0;
+    }
+    size_t ik = static_cast<size_t>( ::atol(m_path[1].c_str()) );
+    if ( ik >= m_baseline.kernels.size() ) {
+      m_baseline.kernels.resize(ik + 1);
+    }
+    return &m_baseline.kernels[ik];
+  }
+
+  void setString(const std::string& str)
+  {
+    if ( m_path.size() == 2 && m_path[0] == "variants" ) {
+      m_baseline.variants.push_back(str);
+    } else if ( m_path.size() == 2 && m_path[0] == "build" &&
+                m_path[1] == "precision" ) {
+      m_baseline.precision = str;
+    } else if ( m_path.size() == 3 && m_path[2] == "name" ) {
+      BaselineKernel* kern = kernelAtPath();
+      if ( kern ) kern->name = str;
+    }
+  }
+
+  void setNumber(double val)
+  {
+    BaselineKernel* kern = kernelAtPath();
+    if ( !kern ) {
+      return;
+    }
+    if ( m_path.size() == 3 && m_path[2] == "run_size" ) {
+      kern->run_size = static_cast<Index_type>(val);
+    } else if ( m_path.size() == 3 && m_path[2] == "run_reps" ) {
+      kern->run_reps = static_cast<Index_type>(val);
+    } else if ( m_path.size() == 6 && m_path[2] == "variants" &&
+                m_path[4] == "pass_times" ) {
+      kern->pass_times[m_path[3]].push_back(val);
+    }
+  }
+
+  const std::string& m_text;
+  size_t m_pos;
+  std::vector<std::string> m_path;
+  BaselineRun& m_baseline;
+};
+
+
+bool loadBaselineRun(const std::string& path,
+                     const std::string& file_prefix,
+                     BaselineRun& baseline)
+{
+  baseline = BaselineRun();
+
+  std::string filename(path);
+  struct stat status;
+  if ( stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode) ) {
+    filename = path + "/" + file_prefix + ".json";
+  }
+
+  std::ifstream file(filename.c_str());
+  if ( !file ) {
+    std::cout << "\n ERROR: Can't open baseline run file " << filename
+              << std::endl;
+    return false;
+  }
+
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const std::string text = contents.str();
+
+  BaselineJSONReader reader(text, baseline);
+  if ( !reader.read() ) {
+    std::cout << "\n ERROR: Can't parse baseline run file " << filename
+              << " (near character " << reader.position() << ")"
+              << std::endl;
+    return false;
+  }
+
+  if ( baseline.kernels.empty() ) {
+    std::cout << "\n ERROR: No kernel timing data in baseline run file "
+              << filename << std::endl;
+    return false;
+  }
+
+  baseline.source = filename;
+  return true;
+}
+
+}  // closing brace for rajaperf namespace
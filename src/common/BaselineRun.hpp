@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Types and methods for loading timing data of a previous suite run,
+/// used as a baseline to detect performance regressions.
+///
+/// Baseline data is read from the JSON report file written by a previous
+/// run (see Executor::writeJSONReport). Only the entries needed to compare
+/// runs are kept; all other entries in the file are skipped.
+///
+
+#ifndef RAJAPerf_BaselineRun_HPP
+#define RAJAPerf_BaselineRun_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+#include <vector>
+#include <map>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Timing data for one kernel of a baseline run.
+ */
+struct BaselineKernel
+{
+  BaselineKernel() : run_size(0), run_reps(0) { ; }
+
+  std::string name;
+  Index_type run_size;
+  Index_type run_reps;
+
+  /// Time of each pass (sec.) of each variant run, keyed by variant name.
+  std::map<std::string, std::vector<double> > pass_times;
+};
+
+/*!
+ * \brief Timing data for all kernels of a baseline run.
+ */
+struct BaselineRun
+{
+  std::string source;
+  std::string precision;
+  std::vector<std::string> variants;
+  std::vector<BaselineKernel> kernels;
+
+  /*!
+   * \brief Return pointer to data for kernel with given name, or null
+   *        if kernel was not run in baseline.
+   */
+  const BaselineKernel* findKernel(const std::string& name) const;
+};
+
+/*!
+ * \brief Load baseline run data from given path.
+ *
+ * Path may name a JSON report file or a directory containing one named
+ * '<file_prefix>.json'. Returns true if data was read successfully;
+ * otherwise, prints an error message and returns false.
+ */
+bool loadBaselineRun(const std::string& path,
+                     const std::string& file_prefix,
+                     BaselineRun& baseline);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -11,13 +11,499 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#if defined(RUN_THREADPOOL)
+#include "common/ThreadPool.hpp"
+#endif
+
+#include <cstdint>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <map>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace rajaperf
 {
 
 static int data_init_count = 0;
 
+static size_t data_alloc_bytes = 0;
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each data placement policy.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF PLACEMENT IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string DataPlacementNames [] =
+{
+  std::string("first-touch"),
+  std::string("interleave"),
+  std::string("local"),
+
+  std::string("Unknown Placement")  // Keep this at the end and DO NOT remove....
+
+}; // END DataPlacementNames
+
+static DataPlacementID data_placement = FirstTouch;
+
+
+const std::string& getDataPlacementName(DataPlacementID pid)
+{
+  return DataPlacementNames[pid];
+}
+
+void setDataPlacement(DataPlacementID pid)
+{
+  data_placement = pid;
+}
+
+DataPlacementID getDataPlacement()
+{
+  return data_placement;
+}
+
+
+#if defined(__linux__)
+
+/*
+ * Return mask of online NUMA nodes (bit i set for node i), read from sysfs
+ * in cpulist format (e.g., "0-1"); node 0 only if it can't be read.
+ */
+static unsigned long getOnlineNodeMask()
+{
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string list;
+  unsigned long mask = 0;
+  if ( file && std::getline(file, list) ) {
+    std::stringstream ss(list);
+    std::string item;
+    while ( std::getline(ss, item, ',') ) {
+      std::string::size_type dash = item.find('-');
+      int lo = ::atoi(item.substr(0, dash).c_str());
+      int hi = ( dash == std::string::npos ? lo 
+                                           : ::atoi(item.substr(dash+1).c_str()) );
+      for (int node = lo; node <= hi && node < int(8*sizeof(mask)); ++node) {
+        mask |= (1UL << node);
+      }
+    }
+  }
+  return ( mask ? mask : 1UL );
+}
+
+/*
+ * Set placement policy for pages of newly allocated data array. Only whole
+ * pages inside the array are set. Pages already in memory (e.g., reused by
+ * the allocator) are moved to comply with the policy.
+ */
+static void placeData(void* ptr, size_t nbytes)
+{
+  if ( data_placement == FirstTouch || nbytes == 0 ) {
+    return;
+  }
+
+  const unsigned long page = static_cast<unsigned long>( sysconf(_SC_PAGESIZE) );
+  unsigned long begin = ( reinterpret_cast<unsigned long>(ptr) + page - 1 ) &
+                        ~(page - 1);
+  unsigned long end = ( reinterpret_cast<unsigned long>(ptr) + nbytes ) & 
+                      ~(page - 1);
+  if ( end <= begin ) {
+    return;
+  }
+
+  int mode = MPOL_INTERLEAVE;
+  unsigned long nodemask = getOnlineNodeMask();
+  if ( data_placement == Local ) {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    syscall(SYS_getcpu, &cpu, &node, 0);
+    mode = MPOL_PREFERRED;
+    nodemask = 1UL << node;
+  }
+
+  long ret = syscall(SYS_mbind, begin, end - begin, mode, 
+                     &nodemask, 8*sizeof(nodemask), MPOL_MF_MOVE);
+  if ( ret != 0 ) {
+    std::cout << "\n Data placement '" 
+              << getDataPlacementName(data_placement) 
+              << "' failed (mbind); using first-touch" << std::endl;
+    data_placement = FirstTouch;
+  }
+}
+
+#else  // no mbind on this system
+
+static void placeData(void* ptr, size_t nbytes)
+{
+  (void) ptr;
+  (void) nbytes;
+  if ( data_placement != FirstTouch ) {
+    std::cout << "\n Data placement '" 
+              << getDataPlacementName(data_placement) 
+              << "' is only supported on Linux; using first-touch" 
+              << std::endl;
+    data_placement = FirstTouch;
+  }
+}
+
+#endif
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each huge page mode.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF HUGE PAGE MODE IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string HugePageNames [] =
+{
+  std::string("none"),
+  std::string("thp"),
+  std::string("explicit"),
+
+  std::string("Unknown Huge Page Mode")  // Keep this at the end and DO NOT remove....
+
+}; // END HugePageNames
+
+static HugePageID huge_pages = NoHugePages;
+
+/*
+ * Huge page size; arrays smaller than this use the default allocator.
+ */
+static const size_t huge_page_bytes = 2*1024*1024;
+
+/*
+ * Bytes requested for each data array block, bytes allocated (rounded up
+ * to a whole number of huge pages for huge page blocks), whether it
+ * was allocated with huge pages and mapped (explicit huge pages) rather
+ * than allocated from the heap, so dealloc routines can free or pool it,
+ * and how its pages were first touched (see getDataInitMode() below).
+ */
+enum DataInitMode { SerialInit, TeamInit, PoolInit };
+
+struct DataBlock
+{
+  size_t data_bytes;
+  size_t nbytes;
+  bool huge;
+  bool mapped;
+  DataInitMode init_mode;
+};
+
+static std::map<void*, DataBlock> data_blocks;
+
+/*
+ * Blocks held by the data pool for reuse, keyed by size requested. 
+ */
+static bool use_data_pool = false;
+static std::multimap<size_t, void*> pooled_blocks;
+
+
+const std::string& getHugePageName(HugePageID hid)
+{
+  return HugePageNames[hid];
+}
+
+void setHugePages(HugePageID hid)
+{
+  huge_pages = hid;
+#if !defined(__linux__)
+  if ( huge_pages != NoHugePages ) {
+    std::cout << "\n Huge pages '" << getHugePageName(huge_pages)
+              << "' are only supported on Linux; using none" << std::endl;
+    huge_pages = NoHugePages;
+  }
+#endif
+}
+
+HugePageID getHugePages()
+{
+  return huge_pages;
+}
+
+#if defined(__linux__)
+
+/*
+ * Allocate data block of given size backed by huge pages in current mode.
+ * Returns null if block is too small or huge pages are not used, in which
+ * case caller should use default allocator.
+ */
+static void* allocHugeData(size_t nbytes, DataBlock& block)
+{
+  if ( huge_pages == NoHugePages || nbytes < huge_page_bytes ) {
+    return 0;
+  }
+
+  block.nbytes = ( nbytes + huge_page_bytes - 1 ) & ~(huge_page_bytes - 1);
+  block.huge = true;
+  block.mapped = false;
+  void* ptr = 0;
+
+#if defined(MAP_HUGETLB)
+  if ( huge_pages == ExplicitHugePages ) {
+    ptr = mmap(0, block.nbytes, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if ( ptr == MAP_FAILED ) {
+      std::cout << "\n Explicit huge pages are not available (mmap);"
+                << " using thp (reserve pages in /proc/sys/vm/nr_hugepages)"
+                << std::endl;
+      huge_pages = TransparentHugePages;
+      ptr = 0;
+    } else {
+      block.mapped = true;
+    }
+  }
+#else
+  if ( huge_pages == ExplicitHugePages ) {
+    std::cout << "\n Explicit huge pages are not supported; using thp"
+              << std::endl;
+    huge_pages = TransparentHugePages;
+  }
+#endif
+
+  if ( !ptr ) {
+    if ( posix_memalign(&ptr, huge_page_bytes, block.nbytes) != 0 ) {
+      return 0;
+    }
+#if defined(MADV_HUGEPAGE)
+    if ( madvise(ptr, block.nbytes, MADV_HUGEPAGE) != 0 ) {
+      std::cout << "\n Transparent huge pages are not available (madvise);"
+                << " using none" << std::endl;
+      huge_pages = NoHugePages;
+    }
+#endif
+  }
+
+  return ptr;
+}
+
+static void deallocHugeData(void* ptr, const DataBlock& block)
+{
+  if ( block.mapped ) {
+    munmap(ptr, block.nbytes);
+  } else {
+    free(ptr);
+  }
+}
+
+#else  // no huge pages on this system
+
+static void* allocHugeData(size_t nbytes, DataBlock& block)
+{
+  (void) nbytes;
+  (void) block;
+  return 0;
+}
+
+static void deallocHugeData(void* ptr, const DataBlock& block)
+{
+  (void) block;
+  free(ptr);
+}
+
+#endif
+
+/*
+ * Return true if data arrays for given variant are initialized by a team
+ * of OpenMP threads: always for OpenMP variants, so pages are first touched
+ * by thread that uses them, and for all variants if pages are placed by
+ * policy rather than by first touch. Values set do not depend on this.
+ */
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+static bool initInParallel(VariantID vid)
+{
+#if defined(RUN_TILED)
+  if ( vid == RAJA_OpenMP_Tiled || vid == Base_OpenMP_TimeTiled ) {
+    return true;
+  }
+#endif
+#if defined(RUN_BATCHED)
+  if ( vid == Base_OpenMP_Batched ) {
+    return true;
+  }
+#endif
+#if defined(RUN_LINE_SOLVE)
+  if ( vid == Base_OpenMP_Lines || vid == Base_OpenMP_Partition ) {
+    return true;
+  }
+#endif
+#if defined(RUN_FUSED)
+  if ( vid == Base_OpenMP_Fused || vid == RAJA_OpenMP_Fused ) {
+    return true;
+  }
+#endif
+#if defined(RUN_STDPAR)
+  //
+  // Parallel algorithm backends split loops into contiguous shares of
+  // iterations too, so a static OpenMP team places pages closest to
+  // the threads that use them.
+  //
+  if ( vid == Base_StdPar ) {
+    return true;
+  }
+#endif
+  return vid == Base_OpenMP || vid == RAJA_OpenMP ||
+         data_placement != FirstTouch;
+}
+#endif
+
+/*
+ * Return how data arrays for given variant are initialized: by threads
+ * of the suite's thread pool for thread pool variants, so each page is
+ * first touched by the pool thread whose initial share of chunks uses it
+ * (pool threads may be bound to other cpus than OpenMP threads), by a
+ * team of OpenMP threads (see initInParallel()), or serially.
+ */
+static DataInitMode getDataInitMode(VariantID vid)
+{
+#if defined(RUN_THREADPOOL)
+  if ( vid == Base_ThreadPool || vid == Lambda_ThreadPool ) {
+    return PoolInit;
+  }
+#endif
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( initInParallel(vid) ) {
+    return TeamInit;
+  }
+#endif
+  (void) vid;
+  return SerialInit;
+}
+
+/*
+ * Run body(i) for i in [0, len) to set entries of data array for given
+ * variant, so its pages are first touched as getDataInitMode() gives.
+ */
+template <typename BODY>
+static void forallDataInit(int len, VariantID vid, const BODY& body)
+{
+  const DataInitMode init_mode = getDataInitMode(vid);
+#if defined(RUN_THREADPOOL)
+  if ( init_mode == PoolInit ) {
+    threadPoolForall(0, len, [&](Index_type i) {
+      body(static_cast<int>(i));
+    });
+    return;
+  }
+#endif
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static) if(init_mode == TeamInit)
+#endif
+  for (int i = 0; i < len; ++i) {
+    body(i);
+  }
+  (void) init_mode;
+}
+
+/*
+ * Allocate aligned block for data array of given size for given variant;
+ * take one of same size from data pool if there is one whose pages were
+ * first touched the same way (serially, by a team of OpenMP threads, or
+ * by the thread pool) as the variant initializes its data, so pooling 
+ * does not change where pages of parallel variant data are placed. Pages of new blocks are placed with
+ * current data placement policy.
+ */
+static void* allocDataBlock(size_t nbytes, VariantID vid)
+{
+  data_alloc_bytes += nbytes;
+
+  const DataInitMode init_mode = getDataInitMode(vid);
+
+  typedef std::multimap<size_t, void*>::iterator PoolIter;
+  std::pair<PoolIter, PoolIter> range = pooled_blocks.equal_range(nbytes);
+  for (PoolIter pooled = range.first; pooled != range.second; ++pooled) {
+    void* ptr = pooled->second;
+    if ( data_blocks[ptr].init_mode == init_mode ) {
+      pooled_blocks.erase(pooled);
+      return ptr;
+    }
+  }
+
+  DataBlock block;
+  void* ptr = allocHugeData(nbytes, block);
+  if ( !ptr ) {
+    block.nbytes = nbytes;
+    block.huge = false;
+    block.mapped = false;
+    ptr = RAJA::allocate_aligned_type<char>(RAJA::DATA_ALIGN, nbytes);
+  }
+  block.data_bytes = nbytes;
+  block.init_mode = init_mode;
+  data_blocks[ptr] = block;
+
+  placeData(ptr, nbytes);
+  return ptr;
+}
+
+static void freeDataBlock(void* ptr)
+{
+  std::map<void*, DataBlock>::iterator it = data_blocks.find(ptr);
+  if ( it == data_blocks.end() ) {
+    return;
+  }
+  if ( it->second.huge ) {
+    deallocHugeData(ptr, it->second);
+  } else {
+    RAJA::free_aligned(static_cast<char*>(ptr));
+  }
+  data_blocks.erase(it);
+}
+
+/*
+ * Free block of data array or, if data pool is used, keep it for reuse
+ * by next array of same size.
+ */
+static void deallocDataBlock(void* ptr)
+{
+  std::map<void*, DataBlock>::iterator it = data_blocks.find(ptr);
+  if ( use_data_pool && it != data_blocks.end() ) {
+    pooled_blocks.insert( std::make_pair(it->second.data_bytes, ptr) );
+  } else {
+    freeDataBlock(ptr);
+  }
+}
+
+
+void setDataPool(bool use_pool)
+{
+  if ( !use_pool ) {
+    releaseDataPool();
+  }
+  use_data_pool = use_pool;
+}
+
+bool useDataPool()
+{
+  return use_data_pool;
+}
+
+void releaseDataPool()
+{
+  for (std::multimap<size_t, void*>::iterator it = pooled_blocks.begin();
+       it != pooled_blocks.end(); ++it) {
+    freeDataBlock(it->second);
+  }
+  pooled_blocks.clear();
+}
+
+
 /*
  * Reset counter for data initialization.
  */
@@ -34,14 +520,26 @@ void incDataInitCount()
   data_init_count++;
 }
 
+/*
+ * Reset and get count of bytes allocated for kernel data.
+ */
+void resetDataAllocBytes()
+{
+  data_alloc_bytes = 0;
+}
+
+size_t getDataAllocBytes()
+{
+  return data_alloc_bytes;
+}
+
 
 /*
  * Allocate and initialize aligned integer data arrays.
  */
 void allocAndInitData(Int_ptr& ptr, int len, VariantID vid)
 {
-  // Should we do this differently for alignment?? If so, change dealloc()
-  ptr = new Int_type[len];
+  ptr = static_cast<Int_ptr>( allocDataBlock(len*sizeof(Int_type), vid) );
   initData(ptr, len, vid);
 }
 
@@ -50,35 +548,30 @@ void allocAndInitData(Int_ptr& ptr, int len, VariantID vid)
  */
 void allocAndInitData(Real_ptr& ptr, int len, VariantID vid )
 {
-  ptr = 
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN, 
-                                           len*sizeof(Real_type));
+  ptr = static_cast<Real_ptr>( allocDataBlock(len*sizeof(Real_type), vid) );
   initData(ptr, len, vid);
 }
 
 void allocAndInitDataConst(Real_ptr& ptr, int len, Real_type val,
                            VariantID vid)
 {
-  (void) vid;
-
-  ptr = 
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN, 
-                                           len*sizeof(Real_type));
+  ptr = static_cast<Real_ptr>( allocDataBlock(len*sizeof(Real_type), vid) );
   initDataConst(ptr, len, val, vid);
 }
 
 void allocAndInitDataRandSign(Real_ptr& ptr, int len, VariantID vid)
 {
-  ptr =
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
-                                           len*sizeof(Real_type));
+  ptr = static_cast<Real_ptr>( allocDataBlock(len*sizeof(Real_type), vid) );
   initDataRandSign(ptr, len, vid);
 }
 
 void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 {
-  // Should we do this differently for alignment?? If so, change dealloc()
-  ptr = new Complex_type[len];
+  ptr = static_cast<Complex_ptr>( 
+          allocDataBlock(len*sizeof(Complex_type), vid) );
+  for (int i = 0; i < len; ++i) {
+    new (&ptr[i]) Complex_type();
+  }
   initData(ptr, len, vid);
 }
 
@@ -89,15 +582,39 @@ void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 void deallocData(Int_ptr& ptr)
 { 
   if (ptr) {
-    delete [] ptr;
+    deallocDataBlock(ptr);
     ptr = 0;
   }
 }
 
+/*!
+ * \brief Data layout names (see DataUtils.hpp).
+ *
+ * IMPORTANT: This is only modified when a new layout is added to the suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF DATA LAYOUT IDS IN HEADER FILE!!!
+ */
+static const std::string DataLayoutNames [] =
+{
+  std::string("soa"),
+  std::string("aos"),
+  std::string("aosoa"),
+
+  std::string("Unknown Layout")  // Keep this at the end and DO NOT remove....
+
+}; // END DataLayoutNames
+
+
+const std::string& getDataLayoutName(DataLayoutID lid)
+{
+  return DataLayoutNames[lid];
+}
+
 void deallocData(Real_ptr& ptr)
 { 
   if (ptr) {
-    RAJA::free_aligned(ptr);
+    deallocDataBlock(ptr);
     ptr = 0;
   }
 }
@@ -105,46 +622,65 @@ void deallocData(Real_ptr& ptr)
 void deallocData(Complex_ptr& ptr)
 {
   if (ptr) { 
-    delete [] ptr;
+    deallocDataBlock(ptr);
     ptr = 0;
   }
 }
 
 
 /*
- * \brief Initialize Int_type data array to 
- * randomly signed positive and negative values.
+ * Return pseudo-random value in [0.0, 1.0) for entry i of sequence with
+ * given seed. Values are computed from the entry index alone (splitmix64
+ * hash of seed and index), so arrays can be set in any order, by any
+ * number of threads, and get the same values.
  */
-void initData(Int_ptr& ptr, int len, VariantID vid)
+static inline uint64_t randomBits(uint64_t seed, Index_type i)
 {
-  (void) vid;
+  uint64_t z = seed + static_cast<uint64_t>(i + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
 
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0;
-    };
-  }
-#endif
+static inline Real_type randomValue(uint64_t seed, Index_type i)
+{
+  return static_cast<Real_type>( 
+           (randomBits(seed, i) >> 11) * (1.0 / 9007199254740992.0) );
+}
 
-  srand(4793);
+/*
+ * Return pseudo-random index in [0, len) for entry i of sequence with 
+ * given seed. The product is computed in double (len times a float value
+ * from randomValue() may round up to len) and clamped, since the product
+ * may still round up to len for large len.
+ */
+static inline Index_type randomIndex(uint64_t seed, Index_type i, 
+                                     Index_type len)
+{
+  const double val = (randomBits(seed, i) >> 11) * (1.0 / 9007199254740992.0);
+  return std::min( static_cast<Index_type>( len * val ), len - 1 );
+}
 
-  Real_type signfact = 0.0;
+static const uint64_t random_seed = 4793;
 
-  for (int i = 0; i < len; ++i) {
-    signfact = Real_type(rand())/RAND_MAX;
-    ptr[i] = ( signfact < 0.5 ? -1 : 1 );
-  };
+/*
+ * \brief Initialize Int_type data array to 
+ * randomly signed positive and negative values.
+ */
+void initData(Int_ptr& ptr, int len, VariantID vid)
+{
+  Int_ptr p = ptr;
 
-  signfact = Real_type(rand())/RAND_MAX; 
-  Int_type ilo = len * signfact;
+// first touch...
+// (values are set in same loop so pages are not touched again serially)
+  forallDataInit(len, vid, [=](int i) {
+    p[i] = ( randomValue(random_seed, i) < 0.5 ? -1 : 1 );
+  });
+
+  Index_type ilo = randomIndex(random_seed, len, len);
   ptr[ilo] = -58;
 
-  signfact = Real_type(rand())/RAND_MAX; 
-  Int_type ihi = len * signfact;
+  Index_type ihi = randomIndex(random_seed, len + 1, len);
   ptr[ihi] = 19;
 
   incDataInitCount();
@@ -157,24 +693,15 @@ void initData(Int_ptr& ptr, int len, VariantID vid)
  */
 void initData(Real_ptr& ptr, int len, VariantID vid) 
 {
-  (void) vid;
-
+  Real_ptr p = ptr;
   Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
 // first touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP || 
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) { 
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  } 
-#endif
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-  } 
+// (values are set in same loop so pages are not touched again serially)
+  forallDataInit(len, vid, [=](int i) {
+    p[i] = factor*static_cast<Real_type>(i + 1.1)/
+                  static_cast<Real_type>(i + 1.12345);
+  });
 
   incDataInitCount();
 }
@@ -185,23 +712,13 @@ void initData(Real_ptr& ptr, int len, VariantID vid)
 void initDataConst(Real_ptr& ptr, int len, Real_type val,
                    VariantID vid) 
 {
+  Real_ptr p = ptr;
 
 // first touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0;
-    };
-  }
-#else
-  (void) vid;
-#endif
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = val;
-  };
+// (values are set in same loop so pages are not touched again serially)
+  forallDataInit(len, vid, [=](int i) {
+    p[i] = val;
+  });
 
   incDataInitCount();
 }
@@ -211,28 +728,15 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
  */
 void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
 {
-  (void) vid;
-
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0.0;
-    };
-  }
-#endif
-
+  Real_ptr p = ptr;
   Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
-  srand(4793);
-
-  for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
-    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
-    ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
-  };
+// first touch...
+// (values are set in same loop so pages are not touched again serially)
+  forallDataInit(len, vid, [=](int i) {
+    Real_type signfact = ( randomValue(random_seed, i) < 0.5 ? -1.0 : 1.0 );
+    p[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
+  });
 
   incDataInitCount();
 }
@@ -242,24 +746,16 @@ void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
  */
 void initData(Complex_ptr& ptr, int len, VariantID vid)
 {
-  (void) vid;
-
+  Complex_ptr p = ptr;
   Complex_type factor = ( data_init_count % 2 ?  Complex_type(0.1,0.2) :
                                                  Complex_type(0.2,0.3) );
 
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) { 
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  }
-#endif
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-  }
+// first touch...
+// (values are set in same loop so pages are not touched again serially)
+  forallDataInit(len, vid, [=](int i) {
+    p[i] = factor*static_cast<Real_type>(i + 1.1)/
+                  static_cast<Real_type>(i + 1.12345);
+  });
 
   incDataInitCount();
 }
@@ -279,38 +775,127 @@ void initData(Real_type& d, VariantID vid)
 
 
 /*
- * Calculate and return checksum for data arrays.
+ * Number of entries summed by one thread in checksum calculation. It is
+ * fixed (not based on number of threads) so sums are the same for any 
+ * number of threads.
  */
-long double calcChecksum(const Real_ptr ptr, int len, 
-                         Real_type scale_factor)
+static const Index_type checksum_block_len = 16384;
+
+/*
+ * Add value to running sum with Kahan compensation for lost low bits.
+ */
+static inline void addCompensated(long double& sum, long double& comp,
+                                  long double val)
 {
-  long double tchk = 0.0;
-  for (Index_type j = 0; j < len; ++j) {
-    tchk += (j+1)*ptr[j]*scale_factor;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      std::cout << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
+  long double y = val - comp;
+  long double t = sum + y;
+  comp = (t - sum) - y;
+  sum = t;
+}
+
+/*
+ * Sum weighted entries of each block of data array, then add block sums.
+ * Weight of entry j is given by functor (e.g., (j+1)*ptr[j]*scale_factor).
+ */
+template <typename WEIGHTED_ENTRY>
+static long double calcBlockedChecksum(Index_type len, WEIGHTED_ENTRY entry)
+{
+  if ( len <= 0 ) {
+    return 0.0;
+  }
+
+  const Index_type nblocks = (len + checksum_block_len - 1) / 
+                             checksum_block_len;
+  std::vector<long double> block_sum(nblocks);
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static) if(nblocks > 1)
 #endif
+  for (Index_type ib = 0; ib < nblocks; ++ib) {
+    const Index_type jbegin = ib * checksum_block_len;
+    const Index_type jend = std::min(jbegin + checksum_block_len, len);
+    long double sum = 0.0;
+    long double comp = 0.0;
+    for (Index_type j = jbegin; j < jend; ++j) {
+      addCompensated(sum, comp, entry(j));
+    }
+    block_sum[ib] = sum;
+  }
+
+  long double tchk = 0.0;
+  long double comp = 0.0;
+  for (Index_type ib = 0; ib < nblocks; ++ib) {
+    addCompensated(tchk, comp, block_sum[ib]);
   }
   return tchk;
 }
 
-long double calcChecksum(const Complex_ptr ptr, int len,
+/*
+ * Calculate and return checksum for data arrays.
+ */
+long double calcChecksum(const Real_ptr ptr, Index_type len, 
                          Real_type scale_factor)
 {
-  long double tchk = 0.0;
-  for (Index_type j = 0; j < len; ++j) {
-    tchk += (j+1)*(real(ptr[j])+imag(ptr[j]))*scale_factor;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      std::cout << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
-#endif
+  return calcBlockedChecksum(len, [=](Index_type j) -> long double {
+    return (j+1)*ptr[j]*scale_factor;
+  });
+}
+
+long double calcChecksum(const Complex_ptr ptr, Index_type len,
+                         Real_type scale_factor)
+{
+  return calcBlockedChecksum(len, [=](Index_type j) -> long double {
+    return (j+1)*(real(ptr[j])+imag(ptr[j]))*scale_factor;
+  });
+}
+
+
+/*
+ * Return position in array packed in given layout of element i of field 
+ * ifield.
+ */
+static inline Index_type packedIndex(DataLayoutID lid, int nfields, 
+                                     int ifield, Index_type i)
+{
+  if ( lid == AoS ) {
+    return i * nfields + ifield;
   }
-  return tchk;
+  return (i / aosoa_block_length) * aosoa_block_length * nfields +
+         ifield * aosoa_block_length + i % aosoa_block_length;
 }
 
+void allocAndPackData(Real_ptr& ptr, const Real_ptr* fields, int nfields,
+                      int len, DataLayoutID lid, VariantID vid)
+{
+  //
+  // AoSoA array is padded to a whole number of blocks.
+  //
+  const int nblocks = (len + aosoa_block_length - 1) / aosoa_block_length;
+  const int packed_len = ( lid == AoSoA ? nblocks * aosoa_block_length 
+                                        : len ) * nfields;
+  ptr = static_cast<Real_ptr>( 
+          allocDataBlock(packed_len*sizeof(Real_type), vid) );
 
+// first touch...
+  Real_ptr p = ptr;
+  forallDataInit(len, vid, [=](int i) {
+    for (int ifield = 0; ifield < nfields; ++ifield) {
+      p[ packedIndex(lid, nfields, ifield, i) ] = fields[ifield][i];
+    }
+  });
+  for (int i = len; i < packed_len / nfields; ++i) {
+    for (int ifield = 0; ifield < nfields; ++ifield) {
+      ptr[ packedIndex(lid, nfields, ifield, i) ] = 0.0;
+    }
+  }
+}
+
+void unpackData(Real_ptr field, const Real_ptr packed, int nfields, 
+                int ifield, int len, DataLayoutID lid)
+{
+  for (int i = 0; i < len; ++i) {
+    field[i] = packed[ packedIndex(lid, nfields, ifield, i) ];
+  }
+}
 
 }  // closing brace for rajaperf namespace
@@ -17,11 +17,169 @@
 #include "RAJAPerfSuite.hpp"
 #include "RPTypes.hpp"
 
+#include <cstddef>
+#include <string>
+
 
 namespace rajaperf
 {
 
-  
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each policy for placing pages
+ *        of kernel data arrays in memory of NUMA nodes.
+ *
+ *   FirstTouch -- pages are placed on node of thread that first writes them;
+ *                 data for OpenMP variants is initialized in parallel with
+ *                 the static schedule used by the OpenMP kernels, so each
+ *                 page lands on node of thread that uses it (default)
+ *   Interleave -- pages are interleaved round-robin over all nodes
+ *   Local      -- all pages are placed on node of thread that allocates
+ *                 them (i.e., local to socket that runs the suite driver)
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF PLACEMENT NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum DataPlacementID {
+
+  FirstTouch = 0,
+  Interleave,
+  Local,
+
+  NumDataPlacements // Keep this one last and DO NOT remove (!!)
+
+};
+
+/*!
+ * \brief Return name of data placement policy (as given on command line).
+ */
+const std::string& getDataPlacementName(DataPlacementID pid);
+
+/*!
+ * \brief Set placement policy for data arrays allocated after this call.
+ *
+ * Interleave and Local use the Linux mbind system call; they fall back to
+ * FirstTouch (with a message) on other systems or if it fails.
+ */
+void setDataPlacement(DataPlacementID pid);
+
+/*!
+ * \brief Return placement policy in effect for data arrays.
+ */
+DataPlacementID getDataPlacement();
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each mode of backing large
+ *        kernel data arrays with 2MB huge pages.
+ *
+ *   NoHugePages          -- arrays use default allocator (default)
+ *   TransparentHugePages -- arrays of at least 2MB are aligned to 2MB and
+ *                           marked for transparent huge pages (madvise)
+ *   ExplicitHugePages    -- arrays of at least 2MB are mapped from the
+ *                           kernel's pool of reserved huge pages
+ *                           (MAP_HUGETLB; see /proc/sys/vm/nr_hugepages)
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF HUGE PAGE MODE NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum HugePageID {
+
+  NoHugePages = 0,
+  TransparentHugePages,
+  ExplicitHugePages,
+
+  NumHugePageModes // Keep this one last and DO NOT remove (!!)
+
+};
+
+/*!
+ * \brief Return name of huge page mode (as given on command line).
+ */
+const std::string& getHugePageName(HugePageID hid);
+
+/*!
+ * \brief Set huge page mode for data arrays allocated after this call.
+ *
+ * Huge pages are only supported on Linux. ExplicitHugePages falls back to
+ * TransparentHugePages (with a message) if no reserved huge pages are left.
+ */
+void setHugePages(HugePageID hid);
+
+/*!
+ * \brief Return huge page mode in effect for data arrays.
+ */
+HugePageID getHugePages();
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each layout of the field arrays
+ *        of kernels that have several arrays of the same length.
+ *
+ *   SoA   -- structure of arrays: each field in its own array (default)
+ *   AoS   -- array of structures: fields of each element are adjacent
+ *   AoSoA -- array of structures of arrays: elements are grouped in blocks 
+ *            of aosoa_block_length, and each field of a block is contiguous
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF DATA LAYOUT NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum DataLayoutID {
+
+  SoA = 0,
+  AoS,
+  AoSoA,
+
+  NumDataLayouts // Keep this one last and DO NOT remove (!!)
+
+};
+
+/*!
+ * \brief Number of elements in each block of AoSoA layout (a power of 2).
+ */
+const Index_type aosoa_block_length = 8;
+///
+const Index_type aosoa_block_shift = 3;
+
+/*!
+ * \brief Return name of data layout (as given on command line).
+ */
+const std::string& getDataLayoutName(DataLayoutID lid);
+
+/*!
+ * \brief Set whether data arrays freed by deallocData routines are kept in
+ *        a pool and handed out again for arrays of the same size.
+ *
+ * Pooled blocks are reused as they are, so their pages are not faulted in
+ * or placed again; e.g., variants of a kernel reuse the arrays of the
+ * variant run before them. A block is only reused by a variant that 
+ * initializes data the same way (serially or by a team of OpenMP threads)
+ * as the variant that first touched its pages, so OpenMP variants do not
+ * get pages placed by a sequential variant. Blocks are freed by 
+ * releaseDataPool().
+ */
+void setDataPool(bool use_pool);
+
+/*!
+ * \brief Return true if data arrays are pooled for reuse.
+ */
+bool useDataPool();
+
+/*!
+ * \brief Free all data array blocks held in the pool.
+ */
+void releaseDataPool();
+
+
 /*!
  * Reset counter for data initialization.
  */
@@ -32,9 +190,19 @@ void resetDataInitCount();
  */
 void incDataInitCount();
 
+/*!
+ * Reset count of bytes allocated for kernel data.
+ */
+void resetDataAllocBytes();
+
+/*!
+ * Return number of bytes allocated for kernel data since last reset.
+ */
+size_t getDataAllocBytes();
+
 
 /*!
- * \brief Allocate and initialize Int_type data array.
+ * \brief Allocate and initialize aligned Int_type data array.
  * 
  * Array is initialized using method initData(Int_ptr& ptr...) below.
  */
@@ -74,7 +242,28 @@ void allocAndInitData(Complex_ptr& ptr, int len,
 
 
 /*!
- * \brief Free data arrays.
+ * \brief Allocate Real_type data array holding nfields arrays of length len 
+ *        in given layout (AoS or AoSoA), and copy the arrays into it.
+ *
+ * Fields are numbered by their position in fields array. Array is freed 
+ * with deallocData().
+ */
+void allocAndPackData(Real_ptr& ptr, const Real_ptr* fields, int nfields,
+                      int len, DataLayoutID lid,
+                      VariantID vid = NumVariants);
+
+/*!
+ * \brief Copy field ifield of array packed by allocAndPackData() to array
+ *        of length len.
+ */
+void unpackData(Real_ptr field, const Real_ptr packed, int nfields, 
+                int ifield, int len, DataLayoutID lid);
+
+
+/*!
+ * \brief Free data arrays (or return them to pool, see setDataPool()).
+ *
+ * Arrays must have been allocated with allocAndInit* routines above.
  */
 void deallocData(Int_ptr& ptr);
 ///
@@ -89,6 +278,9 @@ void deallocData(Complex_ptr& ptr);
  * Array entries are randomly initialized to +/-1.
  * Then, two randomly-chosen entries are reset, one to 
  * a value > 1, one to a value < -1.
+ *
+ * Random values are computed from entry index alone (counter-based),
+ * so they are the same for all variants and any number of threads.
  */
 void initData(Int_ptr& ptr, int len,
               VariantID vid = NumVariants);
@@ -145,13 +337,69 @@ void initData(Real_type& d,
  * where weight is a simple function of elemtn index.
  *
  * Checksumn is multiplied by given scale factor.
+ *
+ * Sum is computed over fixed-size blocks of entries (in parallel when 
+ * OpenMP variants are built) with compensated (Kahan) summation, and the 
+ * block sums are added in order, so the result does not depend on the 
+ * number of threads.
  */
-long double calcChecksum(Real_ptr d, int len, 
+long double calcChecksum(Real_ptr d, Index_type len, 
                          Real_type scale_factor = 1.0);
 ///
-long double calcChecksum(Complex_ptr d, int len, 
+long double calcChecksum(Complex_ptr d, Index_type len, 
                          Real_type scale_factor = 1.0);
 
+
+/*!
+ * \brief Pointer-like access to one field of Real_type data array packed in
+ *        AoS or AoSoA layout by allocAndPackData().
+ *
+ * p[i] refers to element i of the field and p + n to the field starting at 
+ * element n, as for a Real_ptr to a separate (SoA) array, so kernel bodies 
+ * written with Real_ptr work unchanged with either. The element offset is 
+ * kept apart from the pointer so offsets into neighboring elements (e.g., 
+ * mesh stencils) map to the right blocks of an AoSoA layout.
+ */
+template <DataLayoutID LAYOUT>
+class LayoutReal_ptr
+{
+public:
+  LayoutReal_ptr() : m_field(0), m_stride(0), m_offset(0) { }
+
+  LayoutReal_ptr(Real_ptr packed, Index_type nfields, Index_type ifield)
+    : m_field( packed + ( LAYOUT == AoS ? ifield 
+                                        : ifield * aosoa_block_length ) ),
+      m_stride( LAYOUT == AoS ? nfields : nfields * aosoa_block_length ), 
+      m_offset(0)
+  { }
+
+  //
+  // Block of AoSoA element is found with shift and mask, rather than 
+  // (signed) divide and remainder, so compilers can vectorize loops over 
+  // the elements of a block.
+  //
+  Real_type& operator[](Index_type i) const
+  {
+    const Index_type ie = m_offset + i;
+    return ( LAYOUT == AoS ? 
+             m_field[ie * m_stride] :
+             m_field[(ie >> aosoa_block_shift) * m_stride + 
+                     (ie & (aosoa_block_length - 1))] );
+  }
+
+  LayoutReal_ptr operator+(Index_type n) const
+  {
+    LayoutReal_ptr p(*this);
+    p.m_offset += n;
+    return p;
+  }
+
+private:
+  Real_ptr m_field;
+  Index_type m_stride;  // distance between elements (AoS) or blocks (AoSoA)
+  Index_type m_offset;
+};
+
 }  // closing brace for rajaperf namespace
 
 #endif  // closing endif for header file include guard
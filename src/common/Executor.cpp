@@ -11,19 +11,32 @@
 
 #include "common/KernelBase.hpp"
 #include "common/OutputUtils.hpp"
+#include "common/StatUtils.hpp"
+#include "common/PerfCounters.hpp"
+#include "common/SIMDUtils.hpp"
+#include "common/ThreadPool.hpp"
+#include "common/ThreadUtils.hpp"
+
+#include "rajaperf_config.hpp"
+
+#include "RAJA/util/Timer.hpp"
 
 // Warmup kernel to run first to remove startup overheads in timings
 #include "basic/DAXPY.hpp"
 
 #include <list>
 #include <vector>
+#include <map>
 #include <string>
+#include <algorithm>
 
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <fstream>
 #include <cmath>
+#include <cstdlib>
+#include <ctime>
 
 #include <unistd.h>
 
@@ -34,7 +47,10 @@ using namespace std;
 
 Executor::Executor(int argc, char** argv)
   : run_params(argc, argv),
-    reference_vid(NumVariants)
+    reference_vid(NumVariants),
+    have_perf_counters(false),
+    have_baseline(false),
+    found_regression(false)
 {
   cout << "\n\nReading command line input..." << endl;
 }
@@ -45,6 +61,10 @@ Executor::~Executor()
   for (size_t ik = 0; ik < kernels.size(); ++ik) {
     delete kernels[ik];
   }
+
+  if ( have_perf_counters ) {
+    finalizePerfCounters();
+  }
 }
 
 
@@ -62,11 +82,43 @@ void Executor::setupSuite()
   typedef set<KernelID> KIDset;
   typedef set<VariantID> VIDset;
 
+  //
+  // Load timing data of previous run to compare to, if given. This is done
+  // before anything is run so a bad file is caught right away.
+  //
+  if ( !run_params.getCompareTo().empty() ) {
+    have_baseline = loadBaselineRun(run_params.getCompareTo(), 
+                                    run_params.getOutputFilePrefix(), 
+                                    baseline);
+    if ( !have_baseline ) {
+      run_params.setInputState(RunParams::BadInput);
+      return;
+    }
+  }
+
   //
   // Determine which kernels to execute from input.
   // run_kern will be non-duplicated ordered set of IDs of kernel to run.
   //
-  const Svector& kernel_input = run_params.getKernelInput();
+  // If no kernels are given and we are comparing to a previous run, run 
+  // the kernels in that run that are available in this build.
+  //
+  Svector kernel_input = run_params.getKernelInput();
+  if ( kernel_input.empty() && have_baseline ) {
+    for (size_t ibk = 0; ibk < baseline.kernels.size(); ++ibk) {
+      const string& kname = baseline.kernels[ibk].name;
+      bool found_it = false;
+      for (size_t ik = 0; ik < NumKernels && !found_it; ++ik) {
+        found_it = ( getFullKernelName(static_cast<KernelID>(ik)) == kname );
+      }
+      if ( found_it ) {
+        kernel_input.push_back(kname);
+      } else {
+        cout << "\nKernel " << kname << " in previous run is not available;"
+             << " it will not be compared" << endl;
+      }
+    }
+  }
 
   KIDset run_kern;
 
@@ -150,7 +202,25 @@ void Executor::setupSuite()
   // Determine variants to execute from input.
   // run_var will be non-duplicated ordered set of IDs of variants to run.
   //
-  const Svector& variant_input = run_params.getVariantInput();
+  // As with kernels, variants of a previous run to compare to are used
+  // if none are given.
+  //
+  Svector variant_input = run_params.getVariantInput();
+  if ( variant_input.empty() && have_baseline ) {
+    for (size_t ibv = 0; ibv < baseline.variants.size(); ++ibv) {
+      const string& vname = baseline.variants[ibv];
+      bool found_it = false;
+      for (size_t iv = 0; iv < NumVariants && !found_it; ++iv) {
+        found_it = ( getVariantName(static_cast<VariantID>(iv)) == vname );
+      }
+      if ( found_it ) {
+        variant_input.push_back(vname);
+      } else {
+        cout << "\nVariant " << vname << " in previous run is not available;"
+             << " it will not be compared" << endl;
+      }
+    }
+  }
 
   VIDset run_var;
 
@@ -313,9 +383,81 @@ void Executor::reportRunSummary(ostream& str) const
 
     str << "\nHow suite will be run:" << endl;
     str << "\t # passes = " << run_params.getNumPasses() << endl;
+    if ( run_params.getTargetCI() > 0.0 ) {
+      str << "\t   (minimum per kernel variant; more are run until 95% CI is"
+          << " within " << run_params.getTargetCI()*100.0 << "% of mean time"
+          << " or " << run_params.getCIMaxTime() << " sec. is spent)" << endl;
+    }
     str << "\t Kernel size factor = " << run_params.getSizeFactor() << endl;
+    if ( !run_params.getSizeSweep().empty() ) {
+      const vector<double>& sweep = run_params.getSizeSweep();
+      str << "\t   (swept over factors of";
+      for (size_t is = 0; is < sweep.size(); ++is) {
+        str << " " << sweep[is];
+      }
+      str << "; rep factor is scaled inversely)" << endl;
+    }
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+    if ( !run_params.getThreadCounts().empty() ) {
+      const vector<int>& thread_counts = run_params.getThreadCounts();
+      str << "\t OpenMP and thread pool variants re-run with threads =";
+      for (size_t it = 0; it < thread_counts.size(); ++it) {
+        str << " " << thread_counts[it];
+      }
+      str << endl;
+    }
+    str << "\t Data placement = " 
+        << getDataPlacementName(run_params.getDataPlacement()) << endl;
+    if ( run_params.getDataLayout() != SoA ) {
+      str << "\t Data layout = " 
+          << getDataLayoutName(run_params.getDataLayout())
+          << " (kernels that define layouts, Seq and OpenMP variants)" << endl;
+    }
+    if ( run_params.useDataPool() ) {
+      str << "\t Data arrays reused across variants (data pool)" << endl;
+    }
+    if ( run_params.getHugePages() != NoHugePages ) {
+      str << "\t Huge pages for large data arrays = " 
+          << getHugePageName(run_params.getHugePages()) << endl;
+    }
+    if ( run_params.getThreadBind() != NoBind ) {
+      str << "\t Thread binding = " 
+          << getThreadBindName(run_params.getThreadBind()) << endl;
+    }
+#if defined(RUN_THREADPOOL)
+    str << "\t Thread pool variants use " << getThreadPoolSize() 
+        << " threads (work stealing)" << endl;
+#endif
+#if defined(RUN_TILED)
+    if ( run_params.tuneTiles() ) {
+      str << "\t Tiled variants use tile size and register block tuned"
+          << " for each kernel" << endl;
+    } else {
+      str << "\t Tiled variants use tile size " << run_params.getTileSize()
+          << " and register block " << run_params.getRegisterBlock() << endl;
+    }
+    str << "\t Time-tiled variants run " << run_params.getTimeBlock()
+        << " time steps per tile" << endl;
+#endif
+#if defined(RUN_BATCHED)
+    str << "\t Batched variants run " << run_params.getBatchSize()
+        << " problem instances per rep" << endl;
+#endif
+    str << "\t Floating point precision = " << RP_PRECISION_NAME;
+#if defined(RP_USE_MIXED)
+    str << " (float data, reductions accumulated in double)";
+#endif
+    str << endl;
+#if defined(RUN_SIMD)
+    str << "\t SIMD variants use " << getSIMDISAName() << " vectors of " 
+        << getSIMDWidth() << " Real_type values" << endl;
+#endif
+    str << "\t Time each rep = " 
+        << (run_params.useRepTiming() ? "yes" : "no") << endl;
     str << "\t Output files will be named " << ofiles << endl;
+    if ( have_baseline ) {
+      str << "\t Timings will be compared to " << baseline.source << endl;
+    }
 
     str << "\nThe following kernels and variants will be run:\n"; 
 
@@ -347,6 +489,32 @@ void Executor::runSuite()
     return;
   }
 
+  //
+  // Counters must be opened before warmup kernel starts any threads
+  // so that counts from all threads are included.
+  //
+  if ( run_params.usePerfCounters() ) {
+    cout << "\n\nInitializing hardware counters...";
+    have_perf_counters = initPerfCounters();
+    if ( !have_perf_counters ) {
+      cout << "No hardware counters available;"
+           << " counter report will not be generated." << endl;
+    }
+  }
+
+  setDataPlacement( run_params.getDataPlacement() );
+  setHugePages( run_params.getHugePages() );
+  setDataPool( run_params.useDataPool() );
+
+  //
+  // Bind OpenMP (and thread pool) threads, if asked, before warmup kernel
+  // starts them.
+  //
+  if ( run_params.getThreadBind() != NoBind &&
+       !setNumThreads(getNumThreads(), run_params.getThreadBind()) ) {
+    cout << "\n\nThreads could not be bound to cpus" << endl;
+  }
+
   cout << "\n\nRunning warmup kernel variants...\n";
 
   KernelBase* warmup_kernel = new basic::DAXPY(run_params);
@@ -359,16 +527,21 @@ void Executor::runSuite()
   }
 
   delete warmup_kernel;
+  releaseDataPool();
 
 
+  if ( !run_params.getSizeSweep().empty() ) {
+    runSizeSweep();
+    return;
+  }
+
   cout << "\n\nRunning specified kernels and variants...\n";
 
-  const int npasses = run_params.getNumPasses();
-  for (int ip = 0; ip < npasses; ++ip) {
-    if ( run_params.showProgress() ) {
-      std::cout << "\nPass through suite # " << ip << "\n";
-    }
+  if ( run_params.getTargetCI() > 0.0 ) {
 
+    //
+    // Run passes of each kernel variant until its timing converges.
+    //
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       KernelBase* kernel = kernels[ik];
       if ( run_params.showProgress() ) {
@@ -376,17 +549,266 @@ void Executor::runSuite()
       }
 
       for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-         KernelBase* kern = kernels[ik];
-         if ( run_params.showProgress() ) {
-           cout << kern->getName() << " " <<  getVariantName(variant_ids[iv]) << endl;
-         }  
-         kernels[ik]->execute( variant_ids[iv] );
+        runKernelToConvergence(kernel, variant_ids[iv]);
       } // loop over variants 
+      releaseDataPool();
 
     } // loop over kernels
 
-  } // loop over passes through suite
+  } else {
+
+    const int npasses = run_params.getNumPasses();
+    for (int ip = 0; ip < npasses; ++ip) {
+      if ( run_params.showProgress() ) {
+        std::cout << "\nPass through suite # " << ip << "\n";
+      }
+
+      for (size_t ik = 0; ik < kernels.size(); ++ik) {
+        KernelBase* kernel = kernels[ik];
+        if ( run_params.showProgress() ) {
+          std::cout << "\n   Running kernel -- " << kernel->getName() << "\n"; 
+        }
+
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+           KernelBase* kern = kernels[ik];
+           if ( run_params.showProgress() ) {
+             cout << kern->getName() << " " <<  getVariantName(variant_ids[iv]) << endl;
+           }  
+           kernels[ik]->execute( variant_ids[iv] );
+        } // loop over variants 
+        releaseDataPool();
+
+      } // loop over kernels
+
+    } // loop over passes through suite
+
+  }
+
+  if ( !run_params.getThreadCounts().empty() ) {
+    runThreadScaling();
+  }
+}
+
+void Executor::runKernelToConvergence(KernelBase* kern, VariantID vid)
+{
+  if ( !kern->hasVariantDefined(vid) ) {
+    return;
+  }
+
+  const size_t min_passes = 
+    static_cast<size_t>( max(run_params.getNumPasses(), 2) );
+  const double target_ci = run_params.getTargetCI();
+  const double max_time = run_params.getCIMaxTime();
+
+  RAJA::Timer budget_timer;
+  budget_timer.reset();
+
+  bool converged = false;
+  bool out_of_time = false;
+  double rel_ci = 0.0;
+
+  while ( !converged && !out_of_time ) {
+
+    budget_timer.start();
+    kern->execute(vid);
+    budget_timer.stop();
+
+    const vector<double>& pass_times = kern->getPassTimes(vid);
+    if ( pass_times.size() >= min_passes ) {
+      double mean = calcMean(pass_times);
+      rel_ci = ( mean > 0.0 ? calcConfIntervalHalfWidth95(pass_times) / mean
+                            : 0.0 );
+      converged = ( rel_ci <= target_ci );
+    }
+
+    out_of_time = ( budget_timer.elapsed() >= max_time );
+  }
+
+  if ( run_params.showProgress() || !converged ) {
+    //
+    // A CI needs at least 2 passes; with fewer than min_passes it is 
+    // computed here for the summary only.
+    //
+    const vector<double>& pass_times = kern->getPassTimes(vid);
+    cout << kern->getName() << " " << getVariantName(vid) 
+         << " : " << pass_times.size() << " passes, 95% CI +/-";
+    if ( pass_times.size() < 2 ) {
+      cout << "n/a";
+    } else {
+      double mean = calcMean(pass_times);
+      if ( pass_times.size() < min_passes && mean > 0.0 ) {
+        rel_ci = calcConfIntervalHalfWidth95(pass_times) / mean;
+      }
+      cout << rel_ci*100.0 << "%";
+    }
+    cout << ( converged ? "" : " (NOT CONVERGED, time budget exhausted)" )
+         << endl;
+  }
+}
+
+void Executor::runSizeSweep()
+{
+  const vector<double>& sweep = run_params.getSizeSweep();
+  const double size_fact = run_params.getSizeFactor();
+  const double rep_fact = run_params.getRepFactor();
+
+  cout << "\n\nRunning specified kernels and variants at each size...\n";
+
+  for (size_t is = 0; is < sweep.size(); ++is) {
+
+    //
+    // Kernels size their data when they are constructed, so new kernel 
+    // objects are made for each size. Reps are scaled inversely to size
+    // so that each size takes about as long to run.
+    //
+    run_params.setSizeFactor(size_fact * sweep[is]);
+    run_params.setRepFactor(rep_fact / sweep[is]);
+
+    cout << "\n   Size factor " << run_params.getSizeFactor() << endl;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = getKernelObject(kernels[ik]->getKernelID(),
+                                         run_params);
+      if ( run_params.showProgress() ) {
+        cout << "\n   Running kernel -- " << kern->getName() << "\n"; 
+      }
+
+      if ( run_params.getTargetCI() > 0.0 ) {
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          runKernelToConvergence(kern, variant_ids[iv]);
+        }
+      } else {
+        for (int ip = 0; ip < run_params.getNumPasses(); ++ip) {
+          for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+            kern->execute( variant_ids[iv] );
+          }
+        }
+      }
+
+      SweepResult result;
+      result.kernel_name = kern->getName();
+      result.size_fact = run_params.getSizeFactor();
+      result.run_size = kern->getRunSize();
+      result.data_bytes = kern->getDataBytes();
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        result.bytes_per_rep.push_back( 
+          static_cast<double>(kern->getVariantBytesPerRep(vid)) *
+          kern->getBatchSize(vid) );
+        result.time_per_rep.push_back( kern->wasVariantRun(vid) ?
+          kern->getAvgTime(vid) / kern->getRunReps() : 0.0 );
+      }
+      sweep_results.push_back(result);
+
+      delete kern;
+      releaseDataPool();
+    }
+
+  }
+
+  run_params.setSizeFactor(size_fact);
+  run_params.setRepFactor(rep_fact);
+}
+
+void Executor::runThreadScaling()
+{
+  scaling_vids.clear();
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    if ( variant_ids[iv] == Base_OpenMP || variant_ids[iv] == RAJA_OpenMP ) {
+      scaling_vids.push_back(variant_ids[iv]);
+    }
+#endif
+#if defined(RUN_TILED) && defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    if ( variant_ids[iv] == RAJA_OpenMP_Tiled ||
+         variant_ids[iv] == Base_OpenMP_TimeTiled ) {
+      scaling_vids.push_back(variant_ids[iv]);
+    }
+#endif
+#if defined(RUN_BATCHED) && defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    if ( variant_ids[iv] == Base_OpenMP_Batched ) {
+      scaling_vids.push_back(variant_ids[iv]);
+    }
+#endif
+#if defined(RUN_LINE_SOLVE) && defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    if ( variant_ids[iv] == Base_OpenMP_Lines ||
+         variant_ids[iv] == Base_OpenMP_Partition ) {
+      scaling_vids.push_back(variant_ids[iv]);
+    }
+#endif
+#if defined(RUN_FUSED) && defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    if ( variant_ids[iv] == Base_OpenMP_Fused ||
+         variant_ids[iv] == RAJA_OpenMP_Fused ) {
+      scaling_vids.push_back(variant_ids[iv]);
+    }
+#endif
+#if defined(RUN_THREADPOOL)
+    if ( variant_ids[iv] == Base_ThreadPool || 
+         variant_ids[iv] == Lambda_ThreadPool ) {
+      scaling_vids.push_back(variant_ids[iv]);
+    }
+#endif
+  }
+  if ( scaling_vids.empty() ) {
+    cout << "\n\nNo OpenMP or thread pool variants are run;"
+         << " thread scaling study will not be run." << endl;
+    return;
+  }
+
+  const vector<int>& thread_counts = run_params.getThreadCounts();
+  const ThreadBindID bind = run_params.getThreadBind();
+  const int default_threads = getNumThreads();
+
+  cout << "\n\nRunning OpenMP and thread pool variants with each number"
+       << " of threads...\n";
+
+  scaling_times.assign( kernels.size(), 
+    vector< vector<double> >( scaling_vids.size(), 
+                              vector<double>(thread_counts.size(), 0.0) ) );
+
+  for (size_t it = 0; it < thread_counts.size(); ++it) {
+
+    cout << "\n   Threads " << thread_counts[it] << endl;
+    if ( !setNumThreads(thread_counts[it], bind) ) {
+      cout << "   (threads could not be bound to cpus)" << endl;
+    }
+
+    //
+    // Warm up new threads, then run each kernel with a new kernel object 
+    // so its timings are for this number of threads only.
+    //
+    KernelBase* warmup_kernel = new basic::DAXPY(run_params);
+    for (size_t iv = 0; iv < scaling_vids.size(); ++iv) {
+      warmup_kernel->execute( scaling_vids[iv] );
+    }
+    delete warmup_kernel;
+    releaseDataPool();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = getKernelObject(kernels[ik]->getKernelID(),
+                                         run_params);
+      if ( run_params.showProgress() ) {
+        cout << "\n   Running kernel -- " << kern->getName() << "\n"; 
+      }
+
+      for (size_t iv = 0; iv < scaling_vids.size(); ++iv) {
+        if ( run_params.getTargetCI() > 0.0 ) {
+          runKernelToConvergence(kern, scaling_vids[iv]);
+        } else {
+          for (int ip = 0; ip < run_params.getNumPasses(); ++ip) {
+            kern->execute( scaling_vids[iv] );
+          }
+        }
+        scaling_times[ik][iv][it] = kern->getAvgTime( scaling_vids[iv] );
+      }
+
+      delete kern;
+      releaseDataPool();
+    }
+
+  }
 
+  setNumThreads(default_threads, bind);
 }
 
 void Executor::outputRunData()
@@ -409,6 +831,15 @@ void Executor::outputRunData()
   }
   out_fprefix = "./" + run_params.getOutputFilePrefix();
 
+  //
+  // Kernels in a size sweep are run at the sweep sizes only, so that is 
+  // the only data to report.
+  //
+  if ( !run_params.getSizeSweep().empty() ) {
+    writeSizeSweepReport(out_fprefix + "-sweep.csv");
+    return;
+  }
+
   string filename = out_fprefix + "-timing.csv";
   writeCSVReport(filename, CSVRepMode::Timing, 6 /* prec */);
 
@@ -417,11 +848,55 @@ void Executor::outputRunData()
     writeCSVReport(filename, CSVRepMode::Speedup, 3 /* prec */);
   }
 
+  if ( run_params.getTargetCI() > 0.0 ) {
+    filename = out_fprefix + "-ci.csv";
+    writeCSVReport(filename, CSVRepMode::ConfInterval, 4 /* prec */);
+
+    filename = out_fprefix + "-passes.csv";
+    writeCSVReport(filename, CSVRepMode::NumPasses, 0 /* prec */);
+  }
+
   filename = out_fprefix + "-checksum.txt";
   writeChecksumReport(filename);
 
   filename = out_fprefix + "-fom.csv";
   writeFOMReport(filename);
+
+  filename = out_fprefix + "-roofline.csv";
+  writeRooflineReport(filename);
+
+  filename = out_fprefix + "-overhead.csv";
+  writeOverheadReport(filename);
+
+  filename = out_fprefix + ".json";
+  writeJSONReport(filename);
+
+  filename = out_fprefix + "-tiles.csv";
+  writeTileReport(filename);
+
+  filename = out_fprefix + "-batch.csv";
+  writeBatchReport(filename);
+
+  filename = out_fprefix + "-fused.csv";
+  writeFusedReport(filename);
+
+  filename = out_fprefix + "-timetiled.csv";
+  writeTimeTiledReport(filename);
+
+  if ( have_perf_counters ) {
+    filename = out_fprefix + "-counters.csv";
+    writeCountersReport(filename);
+  }
+
+  if ( !scaling_vids.empty() ) {
+    filename = out_fprefix + "-scaling.csv";
+    writeThreadScalingReport(filename);
+  }
+
+  if ( have_baseline ) {
+    filename = out_fprefix + "-compare.csv";
+    writeCompareReport(filename);
+  }
 }
 
 
@@ -435,6 +910,15 @@ void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
 
   if ( file ) {
 
+    //
+    // Timing report gets rep time distribution columns for each variant
+    // when each kernel rep is timed separately.
+    //
+    size_t nstats = 0;
+    if ( mode == CSVRepMode::Timing && run_params.useRepTiming() ) {
+      nstats = NumRepStats;
+    }
+
     //
     // Set basic table formatting parameters.
     //
@@ -452,6 +936,17 @@ void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
       varcol_width[iv] = max(prec+2, getVariantName(variant_ids[iv]).size()); 
     } 
 
+    vector<size_t> statcol_width(nstats);
+    for (size_t is = 0; is < nstats; ++is) {
+      size_t name_width = getRepStatName(static_cast<RepStat>(is)).size();
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        name_width = max(name_width, 
+                         getVariantName(variant_ids[iv]).size() + 1 + 
+                         getRepStatName(static_cast<RepStat>(is)).size());
+      }
+      statcol_width[is] = max(prec+2, name_width);
+    }
+
     //
     // Print title line.
     //
@@ -461,7 +956,7 @@ void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
     // Wrtie CSV file contents for report.
     // 
 
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    for (size_t iv = 0; iv < variant_ids.size() * (1 + nstats); ++iv) {
       file << sepchr;
     }
     file << endl;
@@ -473,6 +968,11 @@ void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
       file << sepchr <<left<< setw(varcol_width[iv])
            << getVariantName(variant_ids[iv]);
+      for (size_t is = 0; is < nstats; ++is) {
+        file << sepchr <<left<< setw(statcol_width[is])
+             << getVariantName(variant_ids[iv]) + " " + 
+                getRepStatName(static_cast<RepStat>(is));
+      }
     }
     file << endl;
 
@@ -486,6 +986,11 @@ void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
         VariantID vid = variant_ids[iv];
         file << sepchr <<right<< setw(varcol_width[iv]) << setprecision(prec) 
              << std::fixed << getReportDataEntry(mode, kern, vid);
+        for (size_t is = 0; is < nstats; ++is) {
+          file << sepchr <<right<< setw(statcol_width[is]) 
+               << setprecision(prec) << std::fixed 
+               << getRepStatEntry(static_cast<RepStat>(is), kern, vid);
+        }
       }
       file << endl;
     }
@@ -604,8 +1109,8 @@ void Executor::writeFOMReport(const string& filename)
             col_exec_count[col]++;
 
             pct_diff[ik][col] = 
-              (kern->getTotTime(comp_vid) - kern->getTotTime(base_vid)) /
-               kern->getTotTime(base_vid);
+              (kern->getAvgTime(comp_vid) - kern->getAvgTime(base_vid)) /
+               kern->getAvgTime(base_vid);
 
             string pfstring(pass);
             if (pct_diff[ik][col] > run_params.getPFTolerance()) {
@@ -823,57 +1328,1856 @@ void Executor::writeChecksumReport(const string& filename)
 }
 
 
-string Executor::getReportTitle(CSVRepMode mode)
+void Executor::writeCountersReport(const string& filename)
 {
-  string title;
-  switch ( mode ) {
-    case CSVRepMode::Timing : { 
-      title = string("Mean Runtime Report (sec.) "); 
-      break; 
-    }
-    case CSVRepMode::Speedup : { 
-      if ( haveReferenceVariant() ) {
-        title = string("Speedup Report (T_ref/T_var)") +
-                string(": ref var = ") + getVariantName(reference_vid) + 
-                string(" ");
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Columns for each variant are the available counters, followed by 
+    // instructions per cycle if both of those counters are available.
+    //
+    vector<PerfCounterID> counters;
+    for (size_t ic = 0; ic < NumPerfCounters; ++ic) {
+      PerfCounterID cid = static_cast<PerfCounterID>(ic);
+      if ( havePerfCounter(cid) ) {
+        counters.push_back(cid);
       }
-      break; 
     }
-    default : { cout << "\n Unknown CSV report mode = " << mode << endl; }
-  }; 
-  return title;
-}
+    const bool have_ipc = havePerfCounter(Cycles) && 
+                          havePerfCounter(Instructions);
 
-long double Executor::getReportDataEntry(CSVRepMode mode,
-                                         KernelBase* kern, 
-                                         VariantID vid)
-{
-  long double retval = 0.0; 
-  switch ( mode ) {
-    case CSVRepMode::Timing : { 
-      retval = kern->getTotTime(vid) / run_params.getNumPasses();
-      break; 
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    const size_t count_width = 16;
+    const size_t ipc_prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
     }
-    case CSVRepMode::Speedup : { 
-      if ( haveReferenceVariant() ) {
-        retval = kern->getTotTime(reference_vid) / kern->getTotTime(vid);
-#if 0 // RDH DEBUG
-        cout << "Kernel(iv): " << kern->getName() << "(" << vid << ")" << endl;
-        cout << "\tref_time, tot_time, retval = " 
-             << kern->getTotTime(reference_vid) << " , "
-             << kern->getTotTime(vid) << " , "
-             << retval << endl;
-#endif
+    kercol_width++;
+
+    vector<string> col_names;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      const string& vname = getVariantName(variant_ids[iv]);
+      for (size_t ic = 0; ic < counters.size(); ++ic) {
+        col_names.push_back(vname + " " + getPerfCounterName(counters[ic]));
+      }
+      if ( have_ipc ) {
+        col_names.push_back(vname + " IPC");
       }
-      break; 
     }
-    default : { cout << "\n Unknown CSV report mode = " << mode << endl; }
-  }; 
-  return retval;
-}
 
-void Executor::getFOMGroups(vector<FOMGroup>& fom_groups)
-{
+    vector<size_t> col_width(col_names.size());
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      col_width[icol] = max(count_width, col_names[icol].size());
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Hardware Counter Report (mean counts per pass) ";
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr <<left<< setw(col_width[icol]) << col_names[icol];
+    }
+    file << endl;
+
+    //
+    // Print row of data for variants of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName();
+
+      size_t icol = 0;
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        size_t npasses = kern->getPassTimes(vid).size();
+
+        for (size_t ic = 0; ic < counters.size(); ++ic) {
+          double val = 0.0;
+          if ( npasses > 0 ) {
+            val = kern->getCounterTotal(vid, counters[ic]) / npasses;
+          }
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(0) << std::fixed << val;
+        }
+
+        if ( have_ipc ) {
+          double cycles = kern->getCounterTotal(vid, Cycles);
+          double ipc = ( cycles > 0.0 ? 
+                         kern->getCounterTotal(vid, Instructions) / cycles :
+                         0.0 );
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(ipc_prec) << std::fixed << ipc;
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeOverheadReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Columns for each variant are times of each phase of a pass, total
+    // of those, and page faults and system time in setup. Last row is 
+    // sum over kernels, i.e., one pass through suite.
+    //
+    const size_t ncols_per_variant = 7;
+    const char* col_labels[ncols_per_variant] = 
+      { "Setup", "Kernel", "Checksum", "Teardown", "Total",
+        "Page faults", "Fault sys time" };
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string total_row_name("Suite total");
+    const string sepchr(" , ");
+    const size_t col_width_min = 12;
+    const size_t time_prec = 6;
+
+    size_t kercol_width = max(kernel_col_name.size(), total_row_name.size());
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<string> col_names;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      const string& vname = getVariantName(variant_ids[iv]);
+      for (size_t ic = 0; ic < ncols_per_variant; ++ic) {
+        col_names.push_back(vname + " " + col_labels[ic]);
+      }
+    }
+
+    vector<size_t> col_width(col_names.size());
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      col_width[icol] = max(col_width_min, col_names[icol].size());
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Kernel Overhead Report (mean per pass; times in sec.,"
+         << " page faults and system time in setup) ";
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr <<left<< setw(col_width[icol]) << col_names[icol];
+    }
+    file << endl;
+
+    //
+    // Print row of data for variants of each kernel, then row of totals.
+    //
+    vector<double> col_total(col_names.size(), 0.0);
+
+    for (size_t ik = 0; ik <= kernels.size(); ++ik) {
+      const bool total_row = ( ik == kernels.size() );
+      file <<left<< setw(kercol_width) 
+           << ( total_row ? total_row_name : kernels[ik]->getName() );
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        double vals[ncols_per_variant] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+        if ( !total_row ) {
+          KernelBase* kern = kernels[ik];
+          VariantID vid = variant_ids[iv];
+          size_t npasses = kern->getPassTimes(vid).size();
+          if ( npasses > 0 ) {
+            vals[0] = kern->getSetupTime(vid) / npasses;
+            vals[1] = kern->getAvgTime(vid);
+            vals[2] = kern->getChecksumTime(vid) / npasses;
+            vals[3] = kern->getTearDownTime(vid) / npasses;
+            vals[4] = vals[0] + vals[1] + vals[2] + vals[3];
+            vals[5] = kern->getSetupFaults(vid) / npasses;
+            vals[6] = kern->getSetupSysTime(vid) / npasses;
+          }
+        }
+
+        for (size_t ic = 0; ic < ncols_per_variant; ++ic) {
+          size_t icol = iv*ncols_per_variant + ic;
+          if ( total_row ) {
+            vals[ic] = col_total[icol];
+          } else {
+            col_total[icol] += vals[ic];
+          }
+          file << sepchr <<right<< setw(col_width[icol]) 
+               << setprecision( ic == 5 ? 0 : time_prec ) << std::fixed 
+               << vals[ic];
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeRooflineReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Memory bandwidth ceiling for each variant is the best rate achieved
+    // by any Stream kernel run with that variant.
+    //
+    const string& stream_name = getGroupName(Stream);
+    vector<double> bw_ceiling(variant_ids.size(), 0.0);
+    bool have_ceiling = false;
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      if ( kern->getName().find(stream_name) == 0 ) {
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          double bw = getAchievedRate(kern, variant_ids[iv], 
+                        kern->getVariantBytesPerRep(variant_ids[iv]));
+          bw_ceiling[iv] = max(bw_ceiling[iv], bw);
+          have_ceiling = have_ceiling || ( bw > 0.0 );
+        }
+      }
+    }
+    if ( !have_ceiling ) {
+      cout << "\n  No Stream kernels were run;"
+           << " roofline report will not include bandwidth ceilings." << endl;
+    }
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string place_col_name("Placement");
+    const string& placement = getDataPlacementName( getDataPlacement() );
+    const string ceiling_row_name("Stream BW ceiling");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+    const size_t ncols_per_var = 4;
+    const string col_suffix[ncols_per_var] = 
+      { " FLOP/Byte", " GB/s", " GFLOP/s", " %BW" }; 
+
+    size_t kercol_width = max(kernel_col_name.size(), ceiling_row_name.size());
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t placecol_width = max(place_col_name.size(), placement.size());
+
+    vector<size_t> col_width(variant_ids.size() * ncols_per_var);
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        col_width[iv*ncols_per_var + ic] = 
+          max(prec+8, getVariantName(variant_ids[iv]).size() + 
+                      col_suffix[ic].size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Roofline Report : achieved rates and percent of measured "
+         << "Stream bandwidth ceiling ";
+    for (size_t icol = 0; icol < col_width.size() + 1; ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(placecol_width) << place_col_name;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        file << sepchr <<left<< setw(col_width[iv*ncols_per_var + ic])
+             << getVariantName(variant_ids[iv]) + col_suffix[ic];
+      }
+    }
+    file << endl;
+
+    //
+    // Print bandwidth ceiling for each variant (in its GB/s column).
+    //
+    file <<left<< setw(kercol_width) << ceiling_row_name
+         << sepchr <<left<< setw(placecol_width) << placement;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        if ( ic == 1 ) {
+          file << sepchr <<right<< setw(col_width[iv*ncols_per_var + ic]) 
+               << setprecision(prec) << std::fixed << bw_ceiling[iv];
+        } else {
+          file << sepchr <<left<< setw(col_width[iv*ncols_per_var + ic]) 
+               << " ";
+        }
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for variants of each kernel. Intensity is given
+    // for each variant, since fused variants move fewer bytes.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const Index_type flops = kern->getFLOPsPerRep();
+
+      file <<left<< setw(kercol_width) << kern->getName()
+           << sepchr <<left<< setw(placecol_width) << placement;
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        const Index_type bytes = kern->getVariantBytesPerRep(vid);
+        const double intensity = 
+          ( bytes > 0 ? static_cast<double>(flops) / bytes : 0.0 );
+        double bw = getAchievedRate(kern, vid, bytes); 
+        double flop_rate = getAchievedRate(kern, vid, flops); 
+        double pct_ceiling = 
+          ( bw_ceiling[iv] > 0.0 ? 100.0 * bw / bw_ceiling[iv] : 0.0 );
+
+        file << sepchr <<right<< setw(col_width[iv*ncols_per_var]) 
+             << setprecision(prec) << std::fixed << intensity
+             << sepchr <<right<< setw(col_width[iv*ncols_per_var + 1]) 
+             << setprecision(prec) << std::fixed << bw
+             << sepchr <<right<< setw(col_width[iv*ncols_per_var + 2]) 
+             << setprecision(prec) << std::fixed << flop_rate
+             << sepchr <<right<< setw(col_width[iv*ncols_per_var + 3]) 
+             << setprecision(prec) << std::fixed << pct_ceiling;
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeJSONReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Gather build and run environment information.
+    //
+    configuration config;
+
+    const char* user = getenv("USER");
+    config.user_run = ( user ? user : "" );
+
+    const char* systype = getenv("SYS_TYPE");
+    config.systype_run = ( systype ? systype : "" );
+
+    char host[256] = "";
+    gethostname(host, sizeof(host) - 1);
+    config.machine_run = host;
+
+    char date[64] = "";
+    time_t now = time(0);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+    config.date_run = date;
+
+    const string sep(",\n");
+
+    file << "{\n";
+
+    //
+    // Suite and build information.
+    //
+    file << "  \"suite_version\": " 
+         << toJSONString(config.perfsuite_version) << sep;
+    file << "  \"raja_version\": " 
+         << toJSONString(config.raja_version) << sep;
+    file << "  \"build\": {\n"
+         << "    \"systype\": " << toJSONString(config.systype_build) << sep
+         << "    \"machine\": " << toJSONString(config.machine_build) << sep
+         << "    \"compiler\": " << toJSONString(config.compiler) << sep
+         << "    \"compiler_options\": " 
+         << toJSONString(config.compiler_options) << sep
+         << "    \"simd_isa\": " << toJSONString(getSIMDISAName()) << sep
+         << "    \"simd_width\": " << getSIMDWidth() << sep
+         << "    \"precision\": " << toJSONString(RP_PRECISION_NAME) << sep
+         << "    \"real_type_bytes\": " << sizeof(Real_type) << sep
+         << "    \"accum_type_bytes\": " << sizeof(Accum_type) << "\n"
+         << "  }" << sep;
+    file << "  \"run\": {\n"
+         << "    \"user\": " << toJSONString(config.user_run) << sep
+         << "    \"date\": " << toJSONString(config.date_run) << sep
+         << "    \"systype\": " << toJSONString(config.systype_run) << sep
+         << "    \"machine\": " << toJSONString(config.machine_run) << "\n"
+         << "  }" << sep;
+
+    //
+    // Run parameters.
+    //
+    const vector<string>& kernel_input = run_params.getKernelInput();
+    const vector<string>& variant_input = run_params.getVariantInput();
+
+    file << "  \"run_params\": {\n"
+         << "    \"mode\": " 
+         << toJSONString( run_params.getInputState() == RunParams::CheckRun ?
+                          "checkrun" : "perfrun" ) << sep
+         << "    \"npasses\": " << run_params.getNumPasses() << sep
+         << "    \"target_ci\": " 
+         << toJSONNumber(run_params.getTargetCI()) << sep
+         << "    \"ci_max_time\": " 
+         << toJSONNumber(run_params.getCIMaxTime()) << sep
+         << "    \"rep_fact\": " 
+         << toJSONNumber(run_params.getRepFactor()) << sep
+         << "    \"size_fact\": " 
+         << toJSONNumber(run_params.getSizeFactor()) << sep
+         << "    \"size_spec\": " 
+         << toJSONString(run_params.getSizeSpecString()) << sep
+         << "    \"pf_tol\": " 
+         << toJSONNumber(run_params.getPFTolerance()) << sep
+         << "    \"checkrun_reps\": " << run_params.getCheckRunReps() << sep
+         << "    \"rep_timing\": " 
+         << (run_params.useRepTiming() ? "true" : "false") << sep
+         << "    \"data_placement\": " 
+         << toJSONString(getDataPlacementName(getDataPlacement())) << sep
+         << "    \"huge_pages\": " 
+         << toJSONString(getHugePageName(getHugePages())) << sep
+         << "    \"data_layout\": " 
+         << toJSONString(getDataLayoutName(run_params.getDataLayout())) << sep
+         << "    \"data_pool\": " 
+         << (useDataPool() ? "true" : "false") << sep
+         << "    \"tile_size\": " << run_params.getTileSize() << sep
+         << "    \"register_block\": " << run_params.getRegisterBlock() << sep
+         << "    \"tune_tiles\": " 
+         << (run_params.tuneTiles() ? "true" : "false") << sep
+         << "    \"time_block\": " << run_params.getTimeBlock() << sep
+         << "    \"batch_size\": " << run_params.getBatchSize() << sep
+         << "    \"num_threads\": " << getNumThreads() << sep
+#if defined(RUN_THREADPOOL)
+         << "    \"thread_pool_size\": " << getThreadPoolSize() << sep
+#endif
+         << "    \"perf_counters\": " 
+         << (run_params.usePerfCounters() ? "true" : "false") << sep
+         << "    \"reference_variant\": " 
+         << ( haveReferenceVariant() ? 
+              toJSONString(getVariantName(reference_vid)) : "null" ) << sep;
+    file << "    \"kernel_input\": [";
+    for (size_t i = 0; i < kernel_input.size(); ++i) {
+      file << (i > 0 ? ", " : "") << toJSONString(kernel_input[i]);
+    }
+    file << "]" << sep;
+    file << "    \"variant_input\": [";
+    for (size_t i = 0; i < variant_input.size(); ++i) {
+      file << (i > 0 ? ", " : "") << toJSONString(variant_input[i]);
+    }
+    file << "]\n"
+         << "  }" << sep;
+
+    //
+    // Variants run, in report column order.
+    //
+    file << "  \"variants\": [";
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      file << (iv > 0 ? ", " : "") 
+           << toJSONString(getVariantName(variant_ids[iv]));
+    }
+    file << "]" << sep;
+
+    //
+    // Sizes, timings, samples, and checksum for each kernel variant run.
+    //
+    file << "  \"kernels\": [";
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      file << (ik > 0 ? ",\n" : "\n")
+           << "    {\n"
+           << "      \"name\": " << toJSONString(kern->getName()) << sep
+           << "      \"run_size\": " << kern->getRunSize() << sep
+           << "      \"run_reps\": " << kern->getRunReps() << sep
+           << "      \"its_per_rep\": " << kern->getItsPerRep() << sep
+           << "      \"bytes_per_rep\": " << kern->getBytesPerRep() << sep
+           << "      \"flops_per_rep\": " << kern->getFLOPsPerRep() << sep
+           << "      \"variants\": {";
+
+      bool first_variant = true;
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        if ( !kern->wasVariantRun(vid) ) {
+          continue;
+        }
+
+        const vector<double>& pass_times = kern->getPassTimes(vid);
+        const vector<double>& rep_times = kern->getRepTimes(vid);
+
+        file << (first_variant ? "\n" : ",\n")
+             << "        " << toJSONString(getVariantName(vid)) << ": {\n"
+             << "          \"mean_time\": " 
+             << toJSONNumber(kern->getAvgTime(vid)) << sep
+             << "          \"min_time\": " 
+             << toJSONNumber(kern->getMinTime(vid)) << sep
+             << "          \"max_time\": " 
+             << toJSONNumber(kern->getMaxTime(vid)) << sep
+             << "          \"checksum\": " 
+             << toJSONNumber(kern->getChecksum(vid)) << sep
+             << "          \"mean_setup_time\": " 
+             << toJSONNumber(kern->getSetupTime(vid) / pass_times.size()) 
+             << sep
+             << "          \"mean_checksum_time\": " 
+             << toJSONNumber(kern->getChecksumTime(vid) / pass_times.size()) 
+             << sep
+             << "          \"mean_teardown_time\": " 
+             << toJSONNumber(kern->getTearDownTime(vid) / pass_times.size()) 
+             << sep;
+        if ( kern->getPoolChunks(vid) > 0.0 ) {
+          file << "          \"pool_chunks\": " 
+               << toJSONNumber(kern->getPoolChunks(vid)) << sep
+               << "          \"pool_stolen_chunks\": " 
+               << toJSONNumber(kern->getPoolStolenChunks(vid)) << sep;
+        }
+        if ( isTiledVariant(vid) ) {
+          file << "          \"tile_size\": " 
+               << kern->getTileConfig(vid).tile_size << sep
+               << "          \"register_block\": "; 
+          if ( kern->usesRegisterBlock() ) {
+            file << kern->getTileConfig(vid).register_block << sep;
+          } else {
+            file << "null" << sep;
+          }
+          file << "          \"tile_tuned\": " 
+               << (kern->wasTileConfigTuned(vid) ? "true" : "false") << sep;
+        }
+        if ( isBatchedVariant(vid) ) {
+          file << "          \"batch_size\": " 
+               << kern->getBatchSize(vid) << sep;
+        }
+        if ( isFusedVariant(vid) ) {
+          file << "          \"bytes_per_rep\": " 
+               << kern->getVariantBytesPerRep(vid) << sep;
+        }
+        file << "          \"pass_times\": [";
+        for (size_t ip = 0; ip < pass_times.size(); ++ip) {
+          file << (ip > 0 ? ", " : "") << toJSONNumber(pass_times[ip]);
+        }
+        file << "]" << sep;
+        file << "          \"rep_times\": [";
+        for (size_t ir = 0; ir < rep_times.size(); ++ir) {
+          file << (ir > 0 ? ", " : "") << toJSONNumber(rep_times[ir]);
+        }
+        file << "]";
+        if ( have_perf_counters ) {
+          file << sep << "          \"counters\": {";
+          bool first_counter = true;
+          for (size_t ic = 0; ic < NumPerfCounters; ++ic) {
+            PerfCounterID cid = static_cast<PerfCounterID>(ic);
+            if ( havePerfCounter(cid) ) {
+              file << (first_counter ? "" : ", ") 
+                   << toJSONString(getPerfCounterName(cid)) << ": "
+                   << toJSONNumber(kern->getCounterTotal(vid, cid));
+              first_counter = false;
+            }
+          }
+          file << "}";
+        }
+        file << "\n"
+             << "        }";
+
+        first_variant = false;
+      }
+
+      file << (first_variant ? "}\n" : "\n      }\n")
+           << "    }";
+    }
+    file << "\n  ]\n"
+         << "}" << endl;
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeCompareReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  //
+  // Kernel variant status strings; empty when change is within tolerance
+  // or not statistically significant.
+  //
+  const string regressed("REGRESSED");
+  const string improved("IMPROVED");
+  const string no_base("NO_BASE");
+  const string size_diff("SIZE_DIFF");
+
+  const double pf_tol = run_params.getPFTolerance();
+
+  //
+  // Set basic table formatting parameters.
+  //
+  const string kernel_col_name("Kernel  ");
+  const string sepchr(" , ");
+  const size_t prec = 4;
+  const size_t data_width = prec + 10;
+  const size_t status_width = regressed.size();
+
+  size_t kercol_width = kernel_col_name.size();
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+  }
+  kercol_width++;
+
+  vector<string> col_names;
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    const string& vname = getVariantName(variant_ids[iv]);
+    col_names.push_back(vname + " Change");
+    col_names.push_back(vname + " t");
+    col_names.push_back(vname + " Status");
+  }
+
+  vector<size_t> col_width(col_names.size());
+  for (size_t icol = 0; icol < col_names.size(); ++icol) {
+    col_width[icol] = max( ( icol % 3 == 2 ? status_width : data_width ),
+                           col_names[icol].size() );
+  }
+
+  if ( file ) {
+
+    //
+    // Print title lines.
+    //
+    file << "Comparison to Previous Run : signed speedup(-)/slowdown(+) of"
+         << " mean time per rep -> (T_now - T_prev) / T_prev ";
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    file << "Previous run : " << baseline.source;
+    if ( !baseline.precision.empty() && 
+         baseline.precision != RP_PRECISION_NAME ) {
+      file << " (precision = " << baseline.precision << "; this run = "
+           << RP_PRECISION_NAME << ")";
+    }
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    file << "'" << regressed << "' if slowdown is over tolerance (" 
+         << pf_tol << ") and significant (Welch's t-test at 95% when both"
+         << " runs have 2+ passes)";
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr <<left<< setw(col_width[icol]) << col_names[icol];
+    }
+    file << endl;
+  }
+
+  //
+  // Compare samples of time per rep of each kernel variant to those of 
+  // previous run, and print row of comparisons for each kernel. Reps are 
+  // normalized out so runs with different rep counts can be compared.
+  //
+  size_t num_regressed = 0;
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    const BaselineKernel* base_kern = baseline.findKernel(kern->getName());
+
+    if ( file ) {
+      file <<left<< setw(kercol_width) << kern->getName();
+    }
+
+    size_t icol = 0;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      const string& vname = getVariantName(vid);
+
+      vector<double> prev_times;
+      if ( base_kern && base_kern->run_reps > 0 ) {
+        map<string, vector<double> >::const_iterator it = 
+          base_kern->pass_times.find(vname);
+        if ( it != base_kern->pass_times.end() ) {
+          for (size_t ip = 0; ip < it->second.size(); ++ip) {
+            prev_times.push_back( it->second[ip] / base_kern->run_reps );
+          }
+        }
+      }
+
+      vector<double> now_times;
+      if ( kern->wasVariantRun(vid) && kern->getRunReps() > 0 ) {
+        const vector<double>& pass_times = kern->getPassTimes(vid);
+        for (size_t ip = 0; ip < pass_times.size(); ++ip) {
+          now_times.push_back( pass_times[ip] / kern->getRunReps() );
+        }
+      }
+
+      double change = 0.0;
+      double t = 0.0;
+      bool tested = false;
+      string status;
+
+      if ( now_times.empty() ) {
+        // variant was not run, nothing to compare
+      } else if ( prev_times.empty() || calcMean(prev_times) <= 0.0 ) {
+        status = no_base;
+      } else if ( base_kern->run_size != kern->getRunSize() ) {
+        status = size_diff;
+      } else {
+        change = calcMean(now_times) / calcMean(prev_times) - 1.0;
+
+        //
+        // Without two or more samples in each run, the slowdown alone
+        // decides; otherwise it must also be significant.
+        //
+        double dof = 0.0;
+        t = calcWelchT(prev_times, now_times, dof);
+        tested = ( dof > 0.0 );
+        bool significant = !tested || ( std::abs(t) > getTCritical95(dof) );
+
+        if ( significant && change > pf_tol ) {
+          status = regressed;
+          num_regressed++;
+          cout << "\n REGRESSION: " << kern->getName() << " " << vname 
+               << " is " << change*100.0 << "% slower than previous run";
+          if ( tested ) {
+            cout << " (t = " << t << ")";
+          }
+        } else if ( significant && change < -pf_tol ) {
+          status = improved;
+        }
+      }
+
+      if ( file ) {
+        file << sepchr <<right<< setw(col_width[icol++]) 
+             << setprecision(prec) << std::fixed << change;
+        if ( tested ) {
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(2) << std::fixed << t;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol++]) << "n/a";
+        }
+        file << sepchr <<left<< setw(col_width[icol++]) << status;
+      }
+    }
+
+    if ( file ) {
+      file << endl;
+    }
+  }
+
+  if ( num_regressed > 0 ) {
+    cout << "\n\n " << num_regressed << " kernel variant(s) regressed"
+         << " beyond tolerance vs. previous run; see " << filename << endl;
+    found_regression = true;
+  } else {
+    cout << "\n No kernel variants regressed beyond tolerance vs."
+         << " previous run" << endl;
+  }
+
+  if ( file ) {
+    file.flush(); 
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Return sizes (bytes) of data and unified caches of first cpu, indexed by
+ * cache level - 1, read from sysfs; empty if they are not available.
+ */
+static vector<size_t> getCacheSizes()
+{
+  vector<size_t> sizes;
+  for (int idx = 0; idx < 16; ++idx) {
+    ostringstream dir;
+    dir << "/sys/devices/system/cpu/cpu0/cache/index" << idx << "/";
+
+    string type, level, size;
+    ifstream ftype( (dir.str() + "type").c_str() );
+    ifstream flevel( (dir.str() + "level").c_str() );
+    ifstream fsize( (dir.str() + "size").c_str() );
+    if ( !(ftype >> type) || !(flevel >> level) || !(fsize >> size) ) {
+      continue;
+    }
+    if ( type == "Instruction" ) {
+      continue;
+    }
+
+    // Size is given as, e.g., "48K" or "32M"
+    size_t bytes = static_cast<size_t>( ::atol(size.c_str()) );
+    char unit = size[size.size() - 1];
+    if ( unit == 'K' ) bytes *= 1024;
+    if ( unit == 'M' ) bytes *= 1024 * 1024;
+    if ( unit == 'G' ) bytes *= 1024 * 1024 * 1024;
+
+    size_t ilev = static_cast<size_t>( ::atoi(level.c_str()) );
+    if ( ilev < 1 ) {
+      continue;
+    }
+    if ( sizes.size() < ilev ) {
+      sizes.resize(ilev, 0);
+    }
+    sizes[ilev - 1] = bytes;
+  }
+  return sizes;
+}
+
+void Executor::writeSizeSweepReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    const vector<size_t> cache_sizes = getCacheSizes();
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+    const size_t data_width = 12;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<string> col_names;
+    col_names.push_back("Size factor");
+    col_names.push_back("Run size");
+    col_names.push_back("Working set (KiB)");
+    col_names.push_back("Fits in");
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      col_names.push_back(getVariantName(variant_ids[iv]) + " GB/s");
+    }
+
+    vector<size_t> col_width(col_names.size());
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      col_width[icol] = max(data_width, col_names[icol].size());
+    }
+
+    //
+    // Print title lines.
+    //
+    file << "Size Sweep Report : bandwidth (GB/s) of each variant vs."
+         << " working set (bytes of kernel data) ";
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    file << "Cache sizes :";
+    if ( cache_sizes.empty() ) {
+      file << " not available";
+    }
+    for (size_t il = 0; il < cache_sizes.size(); ++il) {
+      if ( cache_sizes[il] > 0 ) {
+        file << " L" << il+1 << " " << cache_sizes[il] / 1024 << " KiB";
+      }
+    }
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr <<left<< setw(col_width[icol]) << col_names[icol];
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel at each size, grouped by kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      for (size_t ir = 0; ir < sweep_results.size(); ++ir) {
+        const SweepResult& result = sweep_results[ir];
+        if ( result.kernel_name != kernels[ik]->getName() ) {
+          continue;
+        }
+
+        string fits_in("DRAM");
+        for (size_t il = 0; il < cache_sizes.size(); ++il) {
+          if ( result.data_bytes <= cache_sizes[il] ) {
+            ostringstream level;
+            level << "L" << il+1;
+            fits_in = level.str();
+            break;
+          }
+        }
+
+        size_t icol = 0;
+        file <<left<< setw(kercol_width) << result.kernel_name;
+        file.unsetf(std::ios::floatfield);
+        file << sepchr <<right<< setw(col_width[icol++]) 
+             << setprecision(6) << result.size_fact;
+        file << sepchr <<right<< setw(col_width[icol++]) << result.run_size;
+        file << sepchr <<right<< setw(col_width[icol++]) 
+             << setprecision(1) << std::fixed << result.data_bytes / 1024.0;
+        file << sepchr <<left<< setw(col_width[icol++]) << fits_in;
+
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          double gbs = ( result.time_per_rep[iv] > 0.0 ?
+                         result.bytes_per_rep[iv] / result.time_per_rep[iv] / 1.0e9 :
+                         0.0 );
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(prec) << std::fixed << gbs;
+        }
+        file << endl;
+      }
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeThreadScalingReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    const vector<int>& thread_counts = run_params.getThreadCounts();
+
+    //
+    // Speedup and efficiency are relative to the smallest thread count,
+    // so a study need not include a single-thread run.
+    //
+    size_t it_ref = 0;
+    for (size_t it = 0; it < thread_counts.size(); ++it) {
+      if ( thread_counts[it] < thread_counts[it_ref] ) {
+        it_ref = it;
+      }
+    }
+    const int ref_threads = thread_counts[it_ref];
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+    const size_t data_width = prec + 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<string> col_names;
+    for (size_t iv = 0; iv < scaling_vids.size(); ++iv) {
+      for (size_t it = 0; it < thread_counts.size(); ++it) {
+        ostringstream prefix;
+        prefix << getVariantName(scaling_vids[iv]) << " " 
+               << thread_counts[it] << "T ";
+        col_names.push_back(prefix.str() + "Time");
+        col_names.push_back(prefix.str() + "Speedup");
+        col_names.push_back(prefix.str() + "Eff");
+      }
+    }
+
+    vector<size_t> col_width(col_names.size());
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      col_width[icol] = max(data_width, col_names[icol].size());
+    }
+
+    //
+    // Print title lines.
+    //
+    file << "Thread Scaling Report : mean time (sec.), strong-scaling speedup"
+         << " -> T_ref / T_p, and parallel efficiency -> speedup * ref / p,"
+         << " with ref = " << ref_threads << " threads ";
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    file << "Thread binding : " << getThreadBindName(run_params.getThreadBind());
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t icol = 0; icol < col_names.size(); ++icol) {
+      file << sepchr <<left<< setw(col_width[icol]) << col_names[icol];
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      file <<left<< setw(kercol_width) << kernels[ik]->getName();
+
+      size_t icol = 0;
+      for (size_t iv = 0; iv < scaling_vids.size(); ++iv) {
+        const vector<double>& times = scaling_times[ik][iv];
+        for (size_t it = 0; it < thread_counts.size(); ++it) {
+          double speedup = ( times[it] > 0.0 ? times[it_ref] / times[it] 
+                                             : 0.0 );
+          double eff = speedup * ref_threads / thread_counts[it];
+
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(6) << std::fixed << times[it];
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(prec) << std::fixed << speedup;
+          file << sepchr <<right<< setw(col_width[icol++]) 
+               << setprecision(prec) << std::fixed << eff;
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Return untiled RAJA variant that a tiled variant is compared to, or
+ * NumVariants if there is none.
+ */
+static VariantID getUntiledVariant(VariantID vid)
+{
+#if defined(RUN_TILED)
+#if defined(RUN_RAJA_SEQ)
+  if ( vid == RAJA_Seq_Tiled ) return RAJA_Seq;
+#endif
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == RAJA_OpenMP_Tiled ) return RAJA_OpenMP;
+#endif
+#endif
+  (void) vid;
+  return NumVariants;
+}
+
+void Executor::writeTileReport(const string& filename)
+{
+  vector<VariantID> tiled_vids;
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    if ( isTiledVariant(variant_ids[iv]) ) {
+      tiled_vids.push_back(variant_ids[iv]);
+    }
+  }
+  vector<KernelBase*> tiled_kernels;
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    bool ran = false;
+    for (size_t iv = 0; iv < tiled_vids.size(); ++iv) {
+      ran = ran || kernels[ik]->wasVariantRun(tiled_vids[iv]);
+    }
+    if ( ran ) {
+      tiled_kernels.push_back(kernels[ik]);
+    }
+  }
+  if ( tiled_kernels.empty() ) {
+    return;
+  }
+
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Columns for each tiled variant are tile size and register block it
+    // used, FLOP rate of untiled RAJA variant and of tiled variant, and 
+    // speedup of tiled variant over untiled one.
+    //
+    const size_t ncols_per_var = 5;
+    const string col_suffix[ncols_per_var] = 
+      { " Tile", " RB", " Untiled GFLOP/s", " GFLOP/s", " Speedup" }; 
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < tiled_kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, tiled_kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<size_t> col_width(tiled_vids.size() * ncols_per_var);
+    for (size_t iv = 0; iv < tiled_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        col_width[iv*ncols_per_var + ic] = 
+          max(prec+8, getVariantName(tiled_vids[iv]).size() + 
+                      col_suffix[ic].size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Tiled Variant Report : tile size and register block "
+         << ( run_params.tuneTiles() ? "(tuned)" : "(from run params)" )
+         << ", and rate vs. untiled RAJA variant ";
+    for (size_t icol = 0; icol < col_width.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < tiled_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        file << sepchr <<left<< setw(col_width[iv*ncols_per_var + ic]) 
+             << getVariantName(tiled_vids[iv]) + col_suffix[ic];
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel.
+    //
+    for (size_t ik = 0; ik < tiled_kernels.size(); ++ik) {
+      KernelBase* kern = tiled_kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName();
+
+      for (size_t iv = 0; iv < tiled_vids.size(); ++iv) {
+        VariantID vid = tiled_vids[iv];
+        VariantID untiled_vid = getUntiledVariant(vid);
+        const size_t icol = iv*ncols_per_var;
+
+        if ( !kern->wasVariantRun(vid) ) {
+          for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+            file << sepchr <<right<< setw(col_width[icol + ic]) << "Not run";
+          }
+          continue;
+        }
+
+        const double rate = 
+          getAchievedRate(kern, vid, kern->getFLOPsPerRep());
+        const double untiled_rate = ( untiled_vid == NumVariants ? 0.0 :
+          getAchievedRate(kern, untiled_vid, kern->getFLOPsPerRep()) );
+
+        file << sepchr <<right<< setw(col_width[icol]) 
+             << kern->getTileConfig(vid).tile_size
+             << sepchr <<right<< setw(col_width[icol + 1]);
+        if ( kern->usesRegisterBlock() ) {
+          file << kern->getTileConfig(vid).register_block;
+        } else {
+          file << "n/a";
+        }
+        file << sepchr <<right<< setw(col_width[icol + 2]) 
+             << setprecision(prec) << std::fixed << untiled_rate
+             << sepchr <<right<< setw(col_width[icol + 3]) 
+             << setprecision(prec) << std::fixed << rate;
+        if ( untiled_rate > 0.0 ) {
+          file << sepchr <<right<< setw(col_width[icol + 4]) 
+               << setprecision(prec) << std::fixed << rate / untiled_rate;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol + 4]) << "Not run";
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Return variant that runs one problem instance per rep that a batched
+ * variant is compared to, or NumVariants if there is none.
+ */
+static VariantID getUnbatchedVariant(VariantID vid)
+{
+#if defined(RUN_BATCHED)
+  if ( vid == Base_Seq_Batched ) return Base_Seq;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP_Batched ) return Base_OpenMP;
+#endif
+#endif
+  (void) vid;
+  return NumVariants;
+}
+
+void Executor::writeBatchReport(const string& filename)
+{
+  vector<VariantID> batched_vids;
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    if ( isBatchedVariant(variant_ids[iv]) ) {
+      batched_vids.push_back(variant_ids[iv]);
+    }
+  }
+  vector<KernelBase*> batched_kernels;
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    bool ran = false;
+    for (size_t iv = 0; iv < batched_vids.size(); ++iv) {
+      ran = ran || kernels[ik]->wasVariantRun(batched_vids[iv]);
+    }
+    if ( ran ) {
+      batched_kernels.push_back(kernels[ik]);
+    }
+  }
+  if ( batched_kernels.empty() ) {
+    return;
+  }
+
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Columns for each batched variant are mean time per problem instance
+    // (microseconds) and FLOP rate of the variant that runs one instance
+    // per rep and of batched variant, and per-instance speedup of batched
+    // variant over the other one.
+    //
+    const size_t ncols_per_var = 5;
+    const string col_suffix[ncols_per_var] = 
+      { " Single us/Inst", " us/Inst", " Single GFLOP/s", " GFLOP/s",
+        " Speedup" }; 
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string batch_col_name("Batch Size");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < batched_kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, batched_kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<size_t> col_width(batched_vids.size() * ncols_per_var);
+    for (size_t iv = 0; iv < batched_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        col_width[iv*ncols_per_var + ic] = 
+          max(prec+8, getVariantName(batched_vids[iv]).size() + 
+                      col_suffix[ic].size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Batched Variant Report : time and rate per problem instance"
+         << " vs. one instance per rep ";
+    for (size_t icol = 0; icol < col_width.size() + 1; ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(batch_col_name.size()) << batch_col_name;
+    for (size_t iv = 0; iv < batched_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        file << sepchr <<left<< setw(col_width[iv*ncols_per_var + ic]) 
+             << getVariantName(batched_vids[iv]) + col_suffix[ic];
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel.
+    //
+    for (size_t ik = 0; ik < batched_kernels.size(); ++ik) {
+      KernelBase* kern = batched_kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName()
+           << sepchr <<right<< setw(batch_col_name.size()) 
+           << run_params.getBatchSize();
+
+      for (size_t iv = 0; iv < batched_vids.size(); ++iv) {
+        VariantID vid = batched_vids[iv];
+        VariantID single_vid = getUnbatchedVariant(vid);
+        const size_t icol = iv*ncols_per_var;
+
+        if ( !kern->wasVariantRun(vid) ) {
+          for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+            file << sepchr <<right<< setw(col_width[icol + ic]) << "Not run";
+          }
+          continue;
+        }
+
+        const bool single_run = ( single_vid != NumVariants &&
+                                  kern->wasVariantRun(single_vid) );
+
+        const double inst_time = 1.0e6 * kern->getAvgTime(vid) / 
+          ( kern->getRunReps() * kern->getBatchSize(vid) );
+        const double single_inst_time = ( !single_run ? 0.0 :
+          1.0e6 * kern->getAvgTime(single_vid) / kern->getRunReps() );
+
+        const double rate = 
+          getAchievedRate(kern, vid, kern->getFLOPsPerRep());
+        const double single_rate = ( !single_run ? 0.0 :
+          getAchievedRate(kern, single_vid, kern->getFLOPsPerRep()) );
+
+        if ( single_run ) {
+          file << sepchr <<right<< setw(col_width[icol]) 
+               << setprecision(prec) << std::fixed << single_inst_time;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol]) << "Not run";
+        }
+        file << sepchr <<right<< setw(col_width[icol + 1]) 
+             << setprecision(prec) << std::fixed << inst_time;
+        if ( single_run ) {
+          file << sepchr <<right<< setw(col_width[icol + 2]) 
+               << setprecision(prec) << std::fixed << single_rate;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol + 2]) << "Not run";
+        }
+        file << sepchr <<right<< setw(col_width[icol + 3]) 
+             << setprecision(prec) << std::fixed << rate;
+        if ( single_run && inst_time > 0.0 ) {
+          file << sepchr <<right<< setw(col_width[icol + 4]) 
+               << setprecision(prec) << std::fixed 
+               << single_inst_time / inst_time;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol + 4]) << "Not run";
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Return variant that runs the loops of a kernel unfused that a fused
+ * variant is compared to, or NumVariants if there is none.
+ */
+static VariantID getUnfusedVariant(VariantID vid)
+{
+#if defined(RUN_FUSED)
+  if ( vid == Base_Seq_Fused ) return Base_Seq;
+#if defined(RUN_RAJA_SEQ)
+  if ( vid == RAJA_Seq_Fused ) return RAJA_Seq;
+#endif
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP_Fused ) return Base_OpenMP;
+  if ( vid == RAJA_OpenMP_Fused ) return RAJA_OpenMP;
+#endif
+#endif
+  (void) vid;
+  return NumVariants;
+}
+
+void Executor::writeFusedReport(const string& filename)
+{
+  vector<VariantID> fused_vids;
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    if ( isFusedVariant(variant_ids[iv]) ) {
+      fused_vids.push_back(variant_ids[iv]);
+    }
+  }
+  vector<KernelBase*> fused_kernels;
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    bool ran = false;
+    for (size_t iv = 0; iv < fused_vids.size(); ++iv) {
+      ran = ran || kernels[ik]->wasVariantRun(fused_vids[iv]);
+    }
+    if ( ran ) {
+      fused_kernels.push_back(kernels[ik]);
+    }
+  }
+  if ( fused_kernels.empty() ) {
+    return;
+  }
+
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Kernel columns are bytes per rep of unfused and fused loops and 
+    // percent of bytes fusion saves. Columns for each fused variant are
+    // mean time per rep (microseconds) of the unfused variant it is
+    // compared to and of the fused variant, and speedup of fused variant.
+    //
+    const size_t nkcols = 3;
+    const string kcol_name[nkcols] = 
+      { "Bytes/Rep", "Fused Bytes/Rep", "Bytes Saved (%)" };
+    const size_t ncols_per_var = 3;
+    const string col_suffix[ncols_per_var] = 
+      { " Unfused us/Rep", " us/Rep", " Speedup" }; 
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < fused_kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, fused_kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<size_t> kcol_width(nkcols);
+    for (size_t ic = 0; ic < nkcols; ++ic) {
+      kcol_width[ic] = max(prec+12, kcol_name[ic].size());
+    }
+
+    vector<size_t> col_width(fused_vids.size() * ncols_per_var);
+    for (size_t iv = 0; iv < fused_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        col_width[iv*ncols_per_var + ic] = 
+          max(prec+8, getVariantName(fused_vids[iv]).size() + 
+                      col_suffix[ic].size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Fused Variant Report : bytes per rep and time per rep"
+         << " vs. unfused loops ";
+    for (size_t icol = 0; icol < nkcols + col_width.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t ic = 0; ic < nkcols; ++ic) {
+      file << sepchr <<left<< setw(kcol_width[ic]) << kcol_name[ic];
+    }
+    for (size_t iv = 0; iv < fused_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        file << sepchr <<left<< setw(col_width[iv*ncols_per_var + ic]) 
+             << getVariantName(fused_vids[iv]) + col_suffix[ic];
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel.
+    //
+    for (size_t ik = 0; ik < fused_kernels.size(); ++ik) {
+      KernelBase* kern = fused_kernels[ik];
+
+      const Index_type bytes = kern->getBytesPerRep();
+      const Index_type fused_bytes = kern->getFusedBytesPerRep();
+      const double pct_saved = ( bytes > 0 ? 
+        100.0 * static_cast<double>(bytes - fused_bytes) / bytes : 0.0 );
+
+      file <<left<< setw(kercol_width) << kern->getName()
+           << sepchr <<right<< setw(kcol_width[0]) << bytes
+           << sepchr <<right<< setw(kcol_width[1]) << fused_bytes
+           << sepchr <<right<< setw(kcol_width[2]) 
+           << setprecision(prec) << std::fixed << pct_saved;
+
+      for (size_t iv = 0; iv < fused_vids.size(); ++iv) {
+        VariantID vid = fused_vids[iv];
+        VariantID unfused_vid = getUnfusedVariant(vid);
+        const size_t icol = iv*ncols_per_var;
+
+        if ( !kern->wasVariantRun(vid) ) {
+          for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+            file << sepchr <<right<< setw(col_width[icol + ic]) << "Not run";
+          }
+          continue;
+        }
+
+        const bool unfused_run = ( unfused_vid != NumVariants &&
+                                   kern->wasVariantRun(unfused_vid) );
+
+        const double rep_time = 
+          1.0e6 * kern->getAvgTime(vid) / kern->getRunReps();
+        const double unfused_rep_time = ( !unfused_run ? 0.0 :
+          1.0e6 * kern->getAvgTime(unfused_vid) / kern->getRunReps() );
+
+        if ( unfused_run ) {
+          file << sepchr <<right<< setw(col_width[icol]) 
+               << setprecision(prec) << std::fixed << unfused_rep_time;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol]) << "Not run";
+        }
+        file << sepchr <<right<< setw(col_width[icol + 1]) 
+             << setprecision(prec) << std::fixed << rep_time;
+        if ( unfused_run && rep_time > 0.0 ) {
+          file << sepchr <<right<< setw(col_width[icol + 2]) 
+               << setprecision(prec) << std::fixed 
+               << unfused_rep_time / rep_time;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol + 2]) << "Not run";
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Return variant that runs one time step at a time over all data that a
+ * time-tiled variant is compared to, or NumVariants if there is none.
+ */
+static VariantID getUntimeTiledVariant(VariantID vid)
+{
+#if defined(RUN_TILED)
+  if ( vid == Base_Seq_TimeTiled ) return Base_Seq;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP_TimeTiled ) return Base_OpenMP;
+#endif
+#endif
+  (void) vid;
+  return NumVariants;
+}
+
+void Executor::writeTimeTiledReport(const string& filename)
+{
+  vector<VariantID> tt_vids;
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    if ( isTimeTiledVariant(variant_ids[iv]) ) {
+      tt_vids.push_back(variant_ids[iv]);
+    }
+  }
+  vector<KernelBase*> tt_kernels;
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    bool ran = false;
+    for (size_t iv = 0; iv < tt_vids.size(); ++iv) {
+      ran = ran || kernels[ik]->wasVariantRun(tt_vids[iv]);
+    }
+    if ( ran ) {
+      tt_kernels.push_back(kernels[ik]);
+    }
+  }
+  if ( tt_kernels.empty() ) {
+    return;
+  }
+
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Columns for each time-tiled variant are mean time per rep 
+    // (microseconds) of the untiled variant it is compared to and of 
+    // the time-tiled variant, and speedup of time-tiled variant.
+    //
+    const size_t ncols_per_var = 3;
+    const string col_suffix[ncols_per_var] = 
+      { " Untiled us/Rep", " us/Rep", " Speedup" }; 
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < tt_kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, tt_kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<size_t> col_width(tt_vids.size() * ncols_per_var);
+    for (size_t iv = 0; iv < tt_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        col_width[iv*ncols_per_var + ic] = 
+          max(prec+8, getVariantName(tt_vids[iv]).size() + 
+                      col_suffix[ic].size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Time-Tiled Variant Report : time per rep vs. untiled variants"
+         << " (time block = " << run_params.getTimeBlock() << ") ";
+    for (size_t icol = 0; icol < col_width.size(); ++icol) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < tt_vids.size(); ++iv) {
+      for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+        file << sepchr <<left<< setw(col_width[iv*ncols_per_var + ic]) 
+             << getVariantName(tt_vids[iv]) + col_suffix[ic];
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel.
+    //
+    for (size_t ik = 0; ik < tt_kernels.size(); ++ik) {
+      KernelBase* kern = tt_kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName();
+
+      for (size_t iv = 0; iv < tt_vids.size(); ++iv) {
+        VariantID vid = tt_vids[iv];
+        VariantID untiled_vid = getUntimeTiledVariant(vid);
+        const size_t icol = iv*ncols_per_var;
+
+        if ( !kern->wasVariantRun(vid) ) {
+          for (size_t ic = 0; ic < ncols_per_var; ++ic) {
+            file << sepchr <<right<< setw(col_width[icol + ic]) << "Not run";
+          }
+          continue;
+        }
+
+        const bool untiled_run = ( untiled_vid != NumVariants &&
+                                   kern->wasVariantRun(untiled_vid) );
+
+        const double rep_time = 
+          1.0e6 * kern->getAvgTime(vid) / kern->getRunReps();
+        const double untiled_rep_time = ( !untiled_run ? 0.0 :
+          1.0e6 * kern->getAvgTime(untiled_vid) / kern->getRunReps() );
+
+        if ( untiled_run ) {
+          file << sepchr <<right<< setw(col_width[icol]) 
+               << setprecision(prec) << std::fixed << untiled_rep_time;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol]) << "Not run";
+        }
+        file << sepchr <<right<< setw(col_width[icol + 1]) 
+             << setprecision(prec) << std::fixed << rep_time;
+        if ( untiled_run && rep_time > 0.0 ) {
+          file << sepchr <<right<< setw(col_width[icol + 2]) 
+               << setprecision(prec) << std::fixed 
+               << untiled_rep_time / rep_time;
+        } else {
+          file << sepchr <<right<< setw(col_width[icol + 2]) << "Not run";
+        }
+      }
+      file << endl;
+    }
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+double Executor::getAchievedRate(KernelBase* kern, VariantID vid,
+                                 Index_type count_per_rep)
+{
+  //
+  // Returns count (e.g., bytes or FLOPs) per second in units of 10^9, 
+  // based on mean time of a pass over all reps of the kernel (and all 
+  // problem instances of each rep, for batched variants).
+  //
+  double avg_time = kern->getAvgTime(vid);
+  if ( !kern->wasVariantRun(vid) || avg_time <= 0.0 ) {
+    return 0.0;
+  }
+  return static_cast<double>(count_per_rep) * kern->getBatchSize(vid) *
+         kern->getRunReps() / avg_time / 1.0e9;
+}
+
+
+string Executor::getReportTitle(CSVRepMode mode)
+{
+  string title;
+  switch ( mode ) {
+    case CSVRepMode::Timing : { 
+      title = string("Mean Runtime Report (sec.) : precision = ") +
+              string(RP_PRECISION_NAME) + string(" "); 
+      break; 
+    }
+    case CSVRepMode::Speedup : { 
+      if ( haveReferenceVariant() ) {
+        title = string("Speedup Report (T_ref/T_var)") +
+                string(": ref var = ") + getVariantName(reference_vid) + 
+                string(" ");
+      }
+      break; 
+    }
+    case CSVRepMode::ConfInterval : { 
+      title = string("Relative half-width of 95% confidence interval of mean runtime "); 
+      break; 
+    }
+    case CSVRepMode::NumPasses : { 
+      title = string("Number of passes run "); 
+      break; 
+    }
+    default : { cout << "\n Unknown CSV report mode = " << mode << endl; }
+  }; 
+  return title;
+}
+
+long double Executor::getReportDataEntry(CSVRepMode mode,
+                                         KernelBase* kern, 
+                                         VariantID vid)
+{
+  long double retval = 0.0; 
+  switch ( mode ) {
+    case CSVRepMode::Timing : { 
+      retval = kern->getAvgTime(vid);
+      break; 
+    }
+    case CSVRepMode::Speedup : { 
+      if ( haveReferenceVariant() ) {
+        //
+        // Batched variants run getBatchSize() kernels per rep, so
+        // times are compared per kernel run.
+        //
+        if ( kern->getAvgTime(vid) > 0.0 ) {
+          retval = ( kern->getAvgTime(reference_vid) / 
+                     kern->getBatchSize(reference_vid) ) /
+                   ( kern->getAvgTime(vid) / kern->getBatchSize(vid) );
+        }
+#if 0 // RDH DEBUG
+        cout << "Kernel(iv): " << kern->getName() << "(" << vid << ")" << endl;
+        cout << "\tref_time, tot_time, retval = " 
+             << kern->getTotTime(reference_vid) << " , "
+             << kern->getTotTime(vid) << " , "
+             << retval << endl;
+#endif
+      }
+      break; 
+    }
+    case CSVRepMode::ConfInterval : { 
+      const vector<double>& pass_times = kern->getPassTimes(vid);
+      double mean = calcMean(pass_times);
+      if ( mean > 0.0 ) {
+        retval = calcConfIntervalHalfWidth95(pass_times) / mean;
+      }
+      break; 
+    }
+    case CSVRepMode::NumPasses : { 
+      retval = kern->getPassTimes(vid).size();
+      break; 
+    }
+    default : { cout << "\n Unknown CSV report mode = " << mode << endl; }
+  }; 
+  return retval;
+}
+
+string Executor::getRepStatName(RepStat stat)
+{
+  string name;
+  switch ( stat ) {
+    case RepStat::Median : { name = string("Median"); break; }
+    case RepStat::Pct5 : { name = string("P5"); break; }
+    case RepStat::Pct95 : { name = string("P95"); break; }
+    case RepStat::MAD : { name = string("MAD"); break; }
+    case RepStat::CV : { name = string("CV"); break; }
+    default : { cout << "\n Unknown rep time statistic = " << stat << endl; }
+  };
+  return name;
+}
+
+long double Executor::getRepStatEntry(RepStat stat,
+                                      KernelBase* kern,
+                                      VariantID vid)
+{
+  vector<double> rep_times( kern->getRepTimes(vid) );
+  sort(rep_times.begin(), rep_times.end());
+
+  long double retval = 0.0;
+  switch ( stat ) {
+    case RepStat::Median : { retval = calcMedian(rep_times); break; }
+    case RepStat::Pct5 : { retval = calcPercentile(rep_times, 5.0); break; }
+    case RepStat::Pct95 : { retval = calcPercentile(rep_times, 95.0); break; }
+    case RepStat::MAD : { retval = calcMedianAbsDev(rep_times); break; }
+    case RepStat::CV : { retval = calcCoeffOfVariation(rep_times); break; }
+    default : { cout << "\n Unknown rep time statistic = " << stat << endl; }
+  };
+  return retval;
+}
+
+void Executor::getFOMGroups(vector<FOMGroup>& fom_groups)
+{
   fom_groups.clear();
 
   for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
@@ -888,9 +3192,17 @@ void Executor::getFOMGroups(vector<FOMGroup>& fom_groups)
       string::size_type pos = vname.find("_");
       string pm(vname.substr(pos+1, string::npos));
 
+      //
+      // Group holds variants with the same programming model name (e.g.,
+      // RAJA_Seq for Base_Seq), not variants whose names only contain it,
+      // so tiled, batched, fused, etc. variants are compared only to
+      // their own base variants (or in their own reports).
+      //
       for (size_t ivs = iv+1; ivs < variant_ids.size(); ++ivs) {
         VariantID vids = variant_ids[ivs];
-        if ( getVariantName(vids).find(pm) != string::npos ) {
+        const string& vsname = getVariantName(vids);
+        string::size_type vspos = vsname.find("_");
+        if ( vspos != string::npos && vsname.substr(vspos+1) == pm ) {
           group.variants.push_back(vids);
         }
       }
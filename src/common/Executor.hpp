@@ -11,6 +11,7 @@
 
 #include "common/RAJAPerfSuite.hpp"
 #include "common/RunParams.hpp"
+#include "common/BaselineRun.hpp"
 
 #include <iosfwd>
 #include <utility>
@@ -43,31 +44,91 @@ public:
   
   void outputRunData();
 
+  /*!
+   * \brief Return true if comparison to a previous run (--compare-to) 
+   *        found a kernel variant that regressed beyond tolerance.
+   */
+  bool haveRegressions() const { return found_regression; }
+
 private:
   Executor() = delete;
 
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    ConfInterval,
+    NumPasses,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
 
+  enum RepStat {
+    Median = 0,
+    Pct5,
+    Pct95,
+    MAD,
+    CV,
+
+    NumRepStats // Keep this one last and DO NOT remove (!!)
+  };
+
   struct FOMGroup {
     VariantID base;
     std::vector<VariantID> variants;
   }; 
 
+  struct SweepResult {
+    std::string kernel_name;
+    double size_fact;
+    Index_type run_size;
+    size_t data_bytes;
+    std::vector<double> bytes_per_rep; // for each variant run
+    std::vector<double> time_per_rep;  // for each variant run, 0 if not run
+  };
+
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
 
+  void runKernelToConvergence(KernelBase* kern, VariantID vid);
+
+  void runSizeSweep();
+
+  void runThreadScaling();
+
   void writeCSVReport(const std::string& filename, CSVRepMode mode, 
                       size_t prec);
   std::string getReportTitle(CSVRepMode mode);
   long double getReportDataEntry(CSVRepMode mode, 
                                  KernelBase* kern, VariantID vid);
+  std::string getRepStatName(RepStat stat);
+  long double getRepStatEntry(RepStat stat, 
+                              KernelBase* kern, VariantID vid);
 
   void writeChecksumReport(const std::string& filename);  
 
+  void writeCountersReport(const std::string& filename);
+
+  void writeOverheadReport(const std::string& filename);
+
+  void writeRooflineReport(const std::string& filename);
+
+  void writeJSONReport(const std::string& filename);
+
+  void writeCompareReport(const std::string& filename);
+
+  void writeSizeSweepReport(const std::string& filename);
+
+  void writeThreadScalingReport(const std::string& filename);
+
+  void writeTileReport(const std::string& filename);
+
+  void writeBatchReport(const std::string& filename);
+
+  void writeFusedReport(const std::string& filename);
+
+  void writeTimeTiledReport(const std::string& filename);
+  double getAchievedRate(KernelBase* kern, VariantID vid, 
+                         Index_type count_per_rep);
+
   void writeFOMReport(const std::string& filename);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
   
@@ -76,6 +137,18 @@ private:
   std::vector<VariantID>   variant_ids;
 
   VariantID reference_vid;
+
+  bool have_perf_counters;
+
+  std::vector<SweepResult> sweep_results;
+
+  std::vector<VariantID> scaling_vids;  // OpenMP variants in thread study
+  std::vector< std::vector< std::vector<double> > > scaling_times; 
+                             // mean pass time [kernel][variant][threads]
+
+  BaselineRun baseline;
+  bool have_baseline;
+  bool found_regression;
 };
 
 }  // closing brace for rajaperf namespace
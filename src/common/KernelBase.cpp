@@ -9,8 +9,14 @@
 #include "KernelBase.hpp"
 
 #include "RunParams.hpp"
+#include "ThreadPool.hpp"
 
 #include <cmath>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
 
 namespace rajaperf {
 
@@ -20,15 +26,76 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params)
     name( getFullKernelName(kernel_id) ),
     default_size(0),
     default_reps(0),
-    running_variant(NumVariants)
+    run_size(-1),
+    data_bytes(0),
+    running_variant(NumVariants),
+    timing_reps(false),
+    tuning_tiles(false)
 {
   for (size_t ivar = 0; ivar < NumVariants; ++ivar) {
      num_exec[ivar] = 0;
+     has_variant_defined[ivar] = true;
      min_time[ivar] = std::numeric_limits<double>::max();
      max_time[ivar] = -std::numeric_limits<double>::max();
      tot_time[ivar] = 0.0;
      checksum[ivar] = 0.0;
+     setup_faults[ivar] = 0.0;
+     setup_sys_time[ivar] = 0.0;
+     setup_time[ivar] = 0.0;
+     checksum_time[ivar] = 0.0;
+     teardown_time[ivar] = 0.0;
+     for (size_t ic = 0; ic < NumPerfCounters; ++ic) {
+       counter_tot[ivar][ic] = 0.0;
+     }
+     pool_chunks[ivar] = 0.0;
+     pool_stolen_chunks[ivar] = 0.0;
+     tile_config[ivar].tile_size = params.getTileSize();
+     tile_config[ivar].register_block = params.getRegisterBlock();
+     tile_tuned[ivar] = false;
   }
+
+  has_data_layouts_defined = false;
+
+#if defined(RUN_SIMD)
+  has_variant_defined[Base_SIMD] = false;
+  has_variant_defined[RAJA_SIMD] = false;
+#endif
+#if defined(RUN_THREADPOOL)
+  has_variant_defined[Base_ThreadPool] = false;
+  has_variant_defined[Lambda_ThreadPool] = false;
+#endif
+#if defined(RUN_STDPAR)
+  has_variant_defined[Base_StdPar] = false;
+#endif
+#if defined(RUN_TILED)
+  has_variant_defined[RAJA_Seq_Tiled] = false;
+  has_variant_defined[Base_Seq_TimeTiled] = false;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  has_variant_defined[RAJA_OpenMP_Tiled] = false;
+  has_variant_defined[Base_OpenMP_TimeTiled] = false;
+#endif
+#endif
+#if defined(RUN_BATCHED)
+  has_variant_defined[Base_Seq_Batched] = false;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  has_variant_defined[Base_OpenMP_Batched] = false;
+#endif
+#endif
+#if defined(RUN_LINE_SOLVE)
+  has_variant_defined[Base_Seq_Lines] = false;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  has_variant_defined[Base_OpenMP_Lines] = false;
+  has_variant_defined[Base_OpenMP_Partition] = false;
+#endif
+#endif
+#if defined(RUN_FUSED)
+  has_variant_defined[Base_Seq_Fused] = false;
+  has_variant_defined[RAJA_Seq_Fused] = false;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  has_variant_defined[Base_OpenMP_Fused] = false;
+  has_variant_defined[RAJA_OpenMP_Fused] = false;
+#endif
+#endif
 }
 
  
@@ -39,45 +106,245 @@ KernelBase::~KernelBase()
 
 Index_type KernelBase::getRunSize() const
 { 
+  if ( run_size >= 0 ) {
+    return run_size;
+  }
   return static_cast<Index_type>(default_size*run_params.getSizeFactor()); 
 }
 
 Index_type KernelBase::getRunReps() const
 { 
-  if (run_params.getInputState() == RunParams::CheckRun) {
+  if (timing_reps || tuning_tiles) {
+    return 1;
+  } else if (run_params.getInputState() == RunParams::CheckRun) {
     return static_cast<Index_type>(run_params.getCheckRunReps());
   } else {
-    return static_cast<Index_type>(default_reps*run_params.getRepFactor()); 
+    return std::max( static_cast<Index_type>(1),
+             static_cast<Index_type>(default_reps*run_params.getRepFactor()) );
   } 
 }
 
+DataLayoutID KernelBase::getDataLayout(VariantID vid) const
+{
+  if ( !has_data_layouts_defined ) {
+    return SoA;
+  }
+
+  switch ( vid ) {
+    case Base_Seq :
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq :
+#endif
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP :
+    case RAJA_OpenMP :
+#endif
+    {
+      return run_params.getDataLayout();
+    }
+    default : {
+      return SoA;
+    }
+  }
+}
+
+Index_type KernelBase::getScaledDim(Index_type dim, int ndims) const
+{
+  double scale = std::pow( run_params.getSizeFactor(), 1.0 / ndims );
+  return std::max( static_cast<Index_type>(1), 
+                   static_cast<Index_type>(dim * scale + 0.5) );
+}
+
+
+/*
+ * Read page faults and system time (sec.) of all threads of process so far.
+ */
+static void readPageFaults(double& faults, double& sys_time)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+  if ( getrusage(RUSAGE_SELF, &usage) == 0 ) {
+    faults = static_cast<double>(usage.ru_minflt + usage.ru_majflt);
+    sys_time = usage.ru_stime.tv_sec + 1.0e-6 * usage.ru_stime.tv_usec;
+    return;
+  }
+#endif
+  faults = 0.0;
+  sys_time = 0.0;
+}
+
+
+double KernelBase::getAvgTime(VariantID vid) const
+{
+  if ( pass_times[vid].empty() ) {
+    return 0.0;
+  }
+  return tot_time[vid] / pass_times[vid].size();
+}
+
 
 void KernelBase::execute(VariantID vid) 
 {
+  if ( !hasVariantDefined(vid) ) {
+    return;
+  }
+
   running_variant = vid;
 
+  if ( isTiledVariant(vid) && run_params.tuneTiles() && !tile_tuned[vid] ) {
+    tuneTileConfig(vid);
+  }
+
+  const RAJA::Timer::ElapsedType pass_start_time = tot_time[vid];
+
   resetTimer();
 
   resetDataInitCount();
+  resetDataAllocBytes();
+
+  RAJA::Timer phase_timer;
+  phase_timer.reset();
+
+  double faults_start, sys_start, faults_stop, sys_stop;
+  readPageFaults(faults_start, sys_start);
+  phase_timer.start();
   this->setUp(vid);
+  phase_timer.stop();
+  readPageFaults(faults_stop, sys_stop);
+  data_bytes = getDataAllocBytes();
+  setup_faults[vid] += faults_stop - faults_start;
+  setup_sys_time[vid] += sys_stop - sys_start;
+  setup_time[vid] += phase_timer.elapsed();
   
-  this->runKernel(vid); 
+#if defined(RUN_THREADPOOL)
+  double chunks_start, stolen_start;
+  getThreadPoolChunkCounts(chunks_start, stolen_start);
+#endif
 
+  if ( run_params.useRepTiming() ) {
+
+    //
+    // Run kernel one rep at a time so each rep is timed separately.
+    // Sample buffer is sized up front so no allocation happens between reps.
+    //
+    const Index_type run_reps = getRunReps();
+    rep_times[vid].reserve( run_params.getNumPasses() * run_reps ); 
+
+    timing_reps = true;
+    for (Index_type irep = 0; irep < run_reps; ++irep) {
+      resetTimer();
+      this->runKernel(vid); 
+    }
+    timing_reps = false;
+
+  } else {
+
+    this->runKernel(vid); 
+
+  }
+
+  pass_times[vid].push_back(tot_time[vid] - pass_start_time);
+
+#if defined(RUN_THREADPOOL)
+  double chunks_stop, stolen_stop;
+  getThreadPoolChunkCounts(chunks_stop, stolen_stop);
+  pool_chunks[vid] += chunks_stop - chunks_start;
+  pool_stolen_chunks[vid] += stolen_stop - stolen_start;
+#endif
+
+  phase_timer.reset();
+  phase_timer.start();
   this->updateChecksum(vid); 
+  phase_timer.stop();
+  checksum_time[vid] += phase_timer.elapsed();
 
+  phase_timer.reset();
+  phase_timer.start();
   this->tearDown(vid);
+  phase_timer.stop();
+  teardown_time[vid] += phase_timer.elapsed();
 
   running_variant = NumVariants; 
 }
 
+/*
+ * Time tiled variant with each tile size and register block (fastest of a
+ * few reps, on data set up anew for each) and keep the fastest for all
+ * passes. Times are not recorded as kernel times, and execute() sets up
+ * data again after this, so checksums do not change.
+ *
+ * While tuning, getRunReps() returns 1, so each runKernel() call is one
+ * rep. Each config is timed for up to 3 reps, but fewer when the kernel 
+ * runs fewer reps per pass than that for all configs, so tuning takes 
+ * about as long as one pass (e.g., one rep per config for Large sizes).
+ */
+void KernelBase::tuneTileConfig(VariantID vid)
+{
+  const int num_rbs = usesRegisterBlock() ? num_register_blocks : 1;
+  const Index_type num_configs = num_tile_sizes * num_rbs;
+  const Index_type tune_reps = 
+    std::max( static_cast<Index_type>(1),
+              std::min( getRunReps() / num_configs, 
+                        static_cast<Index_type>(3) ) );
+
+  RAJA::Timer::ElapsedType best_time = std::numeric_limits<double>::max();
+  TileConfig best_config = tile_config[vid];
+
+  tuning_tiles = true;
+  for (int its = 0; its < num_tile_sizes; ++its) {
+    for (int irb = 0; irb < num_rbs; ++irb) {
+
+      tile_config[vid].tile_size = tile_sizes[its];
+      tile_config[vid].register_block = register_blocks[irb];
+
+      resetDataInitCount();
+      this->setUp(vid);
+
+      RAJA::Timer::ElapsedType config_time = 
+        std::numeric_limits<double>::max();
+      for (Index_type irep = 0; irep < tune_reps; ++irep) {
+        resetTimer();
+        this->runKernel(vid);
+        config_time = std::min(config_time, timer.elapsed());
+      }
+
+      this->tearDown(vid);
+
+      if ( config_time < best_time ) {
+        best_time = config_time;
+        best_config = tile_config[vid];
+      }
+
+    }
+  }
+  tuning_tiles = false;
+
+  tile_config[vid] = best_config;
+  tile_tuned[vid] = true;
+}
+
 void KernelBase::recordExecTime()
 {
+  if ( tuning_tiles ) {
+    return;
+  }
+
   num_exec[running_variant]++;
 
   RAJA::Timer::ElapsedType exec_time = timer.elapsed();
   min_time[running_variant] = std::min(min_time[running_variant], exec_time);
-  max_time[running_variant] = std::max(min_time[running_variant], exec_time);
+  max_time[running_variant] = std::max(max_time[running_variant], exec_time);
   tot_time[running_variant] += exec_time;
+
+  if ( timing_reps ) {
+    rep_times[running_variant].push_back(exec_time);
+  }
+
+  if ( run_params.usePerfCounters() ) {
+    for (size_t ic = 0; ic < NumPerfCounters; ++ic) {
+      counter_tot[running_variant][ic] += counter_stop[ic] - counter_start[ic];
+    }
+  }
 }
 
 void KernelBase::print(std::ostream& os) const
@@ -13,10 +13,13 @@
 #include "common/RPTypes.hpp"
 #include "common/DataUtils.hpp"
 #include "common/RunParams.hpp"
+#include "common/PerfCounters.hpp"
+#include "common/TileConfig.hpp"
 
 #include "RAJA/util/Timer.hpp"
 
 #include <string>
+#include <vector>
 #include <iostream>
 
 namespace rajaperf {
@@ -50,12 +53,79 @@ public:
   Index_type getRunSize() const;
   Index_type getRunReps() const;
 
+  size_t getDataBytes() const { return data_bytes; }
+
+  //
+  // Variants that are only implemented for some kernels (e.g., SIMD 
+  // variants) are run only for kernels that define them; execute() does
+  // nothing for a variant that is not defined.
+  //
+  bool hasVariantDefined(VariantID vid) const 
+    { return has_variant_defined[vid]; }
+
   bool wasVariantRun(VariantID vid) const 
     { return num_exec[vid] > 0; }
 
+  //
+  // Kernels that define data layouts pack their field arrays in the layout
+  // given by the run params (see DataUtils.hpp) for sequential and OpenMP 
+  // variants; other variants, and other kernels, use separate (SoA) arrays.
+  //
+  bool hasDataLayoutsDefined() const { return has_data_layouts_defined; }
+  DataLayoutID getDataLayout(VariantID vid) const;
+
+  //
+  // Tile size and register block used by a tiled variant: those given by 
+  // the run params, or, when tiles are tuned, the fastest ones found before
+  // the variant first runs.
+  //
+  const TileConfig& getTileConfig(VariantID vid) const 
+    { return tile_config[vid]; }
+  bool wasTileConfigTuned(VariantID vid) const { return tile_tuned[vid]; }
+
+  //
+  // Independent problem instances a variant runs in each rep: the batch 
+  // size given by the run params for batched variants, 1 for others.
+  // Bytes, FLOPs, and iterations per rep are those of one instance.
+  //
+  Index_type getBatchSize(VariantID vid) const
+    { return isBatchedVariant(vid) ? run_params.getBatchSize() : 1; }
+
   double getMinTime(VariantID vid) const { return min_time[vid]; }
   double getMaxTime(VariantID vid) const { return max_time[vid]; }
   double getTotTime(VariantID vid) { return tot_time[vid]; }
+  double getAvgTime(VariantID vid) const;
+  double getCounterTotal(VariantID vid, PerfCounterID cid) const 
+    { return counter_tot[vid][cid]; }
+  //
+  // Page faults and system (OS kernel) time in setUp() of all passes of
+  // a variant; i.e., cost of faulting in kernel data pages, which is not
+  // part of kernel run time.
+  //
+  double getSetupFaults(VariantID vid) const { return setup_faults[vid]; }
+  double getSetupSysTime(VariantID vid) const { return setup_sys_time[vid]; }
+
+  //
+  // Time (sec.) in setUp(), updateChecksum(), and tearDown() of all
+  // passes of a variant, which is outside timed kernel region.
+  //
+  double getSetupTime(VariantID vid) const { return setup_time[vid]; }
+  double getChecksumTime(VariantID vid) const { return checksum_time[vid]; }
+  double getTearDownTime(VariantID vid) const { return teardown_time[vid]; }
+
+  //
+  // Chunks of loop iterations run by thread pool, and chunks stolen from
+  // another thread's deque, in all passes of a variant (i.e., how much 
+  // work stealing a thread pool variant needed to balance load).
+  //
+  double getPoolChunks(VariantID vid) const { return pool_chunks[vid]; }
+  double getPoolStolenChunks(VariantID vid) const 
+    { return pool_stolen_chunks[vid]; }
+
+  const std::vector<double>& getPassTimes(VariantID vid) const 
+    { return pass_times[vid]; }
+  const std::vector<double>& getRepTimes(VariantID vid) const 
+    { return rep_times[vid]; }
   Checksum_type getChecksum(VariantID vid) const { return checksum[vid]; }
 
   void execute(VariantID vid);
@@ -67,6 +137,9 @@ public:
       cudaDeviceSynchronize();
     }
 #endif
+    if ( run_params.usePerfCounters() ) {
+      readPerfCounters(counter_start);
+    }
     timer.start(); 
   }
 
@@ -77,7 +150,11 @@ public:
       cudaDeviceSynchronize();
     }
 #endif
-    timer.stop(); recordExecTime(); 
+    timer.stop(); 
+    if ( run_params.usePerfCounters() ) {
+      readPerfCounters(counter_stop);
+    }
+    recordExecTime(); 
   }
 
   void resetTimer() { timer.reset(); }
@@ -89,6 +166,34 @@ public:
 
   virtual Index_type getItsPerRep() const { return getRunSize(); }
 
+  //
+  // Bytes moved to/from memory and floating point operations in one
+  // rep of a kernel, used for roofline analysis. Bytes count each array
+  // element read and each element written once per loop that touches it
+  // (i.e., perfect cache reuse within a loop, none across loops). FLOPs
+  // count each add, subtract, multiply, divide, and math function call
+  // in the reference implementation as one operation.
+  //
+  virtual Index_type getBytesPerRep() const { return 0; }
+  virtual Index_type getFLOPsPerRep() const { return 0; }
+
+  //
+  // Bytes moved in one rep by fused variants, counted the same way for
+  // the loops those variants run (so data shared by fused loops counts
+  // once). Kernels with fused variants override this.
+  //
+  virtual Index_type getFusedBytesPerRep() const { return getBytesPerRep(); }
+
+  Index_type getVariantBytesPerRep(VariantID vid) const
+    { return isFusedVariant(vid) ? getFusedBytesPerRep() : getBytesPerRep(); }
+
+  //
+  // False for kernels whose tiled variants ignore the register block
+  // (they call dispatchTiledVariant<false>()), so tuning tries only tile
+  // sizes and reports don't give a register block.
+  //
+  virtual bool usesRegisterBlock() const { return true; }
+
   virtual void print(std::ostream& os) const; 
 
   virtual void setUp(VariantID vid) = 0;
@@ -97,7 +202,22 @@ public:
   virtual void tearDown(VariantID vid) = 0;
 
 protected:
+  //
+  // Kernels whose data is sized by several dimensions (e.g., Polybench
+  // kernels) apply the run size factor to each dimension themselves and
+  // set their run size directly, rather than scaling the default size.
+  // A dimension of data with ndims dimensions is scaled so the data size
+  // grows in proportion to the size factor.
+  //
+  Index_type getScaledDim(Index_type dim, int ndims) const;
+  void setRunSize(Index_type size) { run_size = size; }
+
+  void setVariantDefined(VariantID vid) { has_variant_defined[vid] = true; }
+  void setDataLayoutsDefined() { has_data_layouts_defined = true; }
+
   int num_exec[NumVariants];
+  bool has_variant_defined[NumVariants];
+  bool has_data_layouts_defined;
 
   const RunParams& run_params;
 
@@ -105,6 +225,19 @@ protected:
   RAJA::Timer::ElapsedType max_time[NumVariants];
   RAJA::Timer::ElapsedType tot_time[NumVariants];
 
+  double counter_tot[NumVariants][NumPerfCounters];
+  double setup_faults[NumVariants];
+  double setup_sys_time[NumVariants];
+  RAJA::Timer::ElapsedType setup_time[NumVariants];
+  RAJA::Timer::ElapsedType checksum_time[NumVariants];
+  RAJA::Timer::ElapsedType teardown_time[NumVariants];
+  double pool_chunks[NumVariants];
+  double pool_stolen_chunks[NumVariants];
+
+  std::vector<double> pass_times[NumVariants];  // time of each execute() call
+  std::vector<double> rep_times[NumVariants];  // per-rep samples, filled 
+                                               // only when rep timing is on
+
   Checksum_type checksum[NumVariants];
 
 
@@ -113,15 +246,30 @@ private:
 
   void recordExecTime(); 
 
+  void tuneTileConfig(VariantID vid);
+
   KernelID    kernel_id;
   std::string name;
 
   RAJA::Timer timer;
 
+  double counter_start[NumPerfCounters];
+  double counter_stop[NumPerfCounters];
+
   Index_type default_size;
   Index_type default_reps;
+  Index_type run_size;   // set by kernels that scale their own size, else -1
+
+  size_t data_bytes;     // bytes of data allocated by setUp()
 
   VariantID running_variant; 
+
+  bool timing_reps;  // true while execute() runs kernel one rep at a time
+
+  TileConfig tile_config[NumVariants];
+  bool tile_tuned[NumVariants];
+  bool tuning_tiles;  // true while tuneTileConfig() runs kernel; its times
+                      // are not recorded
 };
 
 }  // closing brace for rajaperf namespace
@@ -13,6 +13,8 @@
 #include<iomanip>
 #include<fstream>
 #include<sstream>
+#include<limits>
+#include<cmath>
 
 #include<sys/types.h>
 #include<sys/stat.h>
@@ -127,4 +129,57 @@ std::string recursiveMkdir(const std::string& in_path)
   return outpath;
 }
 
+/*
+ * Quote and escape string for JSON output.
+ */
+std::string toJSONString(const std::string& str)
+{
+  std::ostringstream out;
+  out << '"';
+  for (size_t i = 0; i < str.size(); ++i) {
+    const char c = str[i];
+    switch ( c ) {
+      case '"'  : { out << "\\\""; break; }
+      case '\\' : { out << "\\\\"; break; }
+      case '\n' : { out << "\\n"; break; }
+      case '\r' : { out << "\\r"; break; }
+      case '\t' : { out << "\\t"; break; }
+      default : {
+        if ( static_cast<unsigned char>(c) < 0x20 ) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') 
+              << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          out << c;
+        }
+      }
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
+/*
+ * Format numbers for JSON output.
+ */
+std::string toJSONNumber(double val)
+{
+  if ( !std::isfinite(val) ) {
+    return std::string("null");
+  }
+  std::ostringstream out;
+  out << std::setprecision(std::numeric_limits<double>::digits10 + 2) << val;
+  return out.str();
+}
+
+std::string toJSONNumber(long double val)
+{
+  if ( !std::isfinite(val) ) {
+    return std::string("null");
+  }
+  std::ostringstream out;
+  out << std::setprecision(std::numeric_limits<long double>::digits10 + 2) 
+      << val;
+  return out.str();
+}
+
 }  // closing brace for rajaperf namespace
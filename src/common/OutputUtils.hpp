@@ -26,6 +26,20 @@ namespace rajaperf
  */
 std::string recursiveMkdir(const std::string& in_path);
 
+/*!
+ * \brief Return given string as a quoted JSON string, with quotes, 
+ * backslashes, and control characters escaped.
+ */
+std::string toJSONString(const std::string& str);
+
+/*!
+ * \brief Return given number as a JSON number with enough digits to
+ * recover its value, or 'null' if it is not finite (JSON has no 
+ * representation for inf or nan).
+ */
+std::string toJSONNumber(double val);
+std::string toJSONNumber(long double val);
+
 }  // closing brace for rajaperf namespace
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,308 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PerfCounters.hpp"
+
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <cerrno>
+#include <cstdint>
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each hardware counter.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF COUNTER IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string PerfCounterNames [] =
+{
+  std::string("Cycles"),
+  std::string("Instructions"),
+  std::string("L1D_Misses"),
+  std::string("LLC_Misses"),
+  std::string("Branch_Misses"),
+  std::string("DTLB_Misses"),
+  std::string("Mem_Read_Bytes"),
+  std::string("Mem_Write_Bytes"),
+
+  std::string("Unknown Counter")  // Keep this at the end and DO NOT remove....
+
+}; // END PerfCounterNames
+
+
+/*
+ * File descriptors opened for each counter and factor to convert each
+ * raw count to counter units (e.g., bytes for uncore memory counters).
+ */
+static std::vector<int> counter_fds[NumPerfCounters];
+static double counter_scale[NumPerfCounters];
+
+
+const std::string& getPerfCounterName(PerfCounterID cid)
+{
+  return PerfCounterNames[cid];
+}
+
+bool havePerfCounter(PerfCounterID cid)
+{
+  return !counter_fds[cid].empty();
+}
+
+
+#if defined(__linux__)
+
+/*
+ * Open single counter; return file descriptor or -1 on failure.
+ */
+static int openCounter(uint32_t type, uint64_t config,
+                       pid_t pid, int cpu, bool inherit)
+{
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attr.inherit = inherit ? 1 : 0;
+  attr.exclude_kernel = ( pid == -1 ? 0 : 1 );
+  attr.exclude_hv = 1;
+
+  return static_cast<int>(
+    syscall(__NR_perf_event_open, &attr, pid, cpu, -1, 0) );
+}
+
+/*
+ * Read single value from given file; return empty string on failure.
+ */
+static std::string readSysFile(const std::string& path)
+{
+  std::ifstream file(path.c_str());
+  std::string val;
+  if ( file ) {
+    std::getline(file, val);
+  }
+  return val;
+}
+
+/*
+ * Parse list of cpus in sysfs cpumask format (e.g., "0,18" or "0-1").
+ */
+static std::vector<int> parseCpuList(const std::string& list)
+{
+  std::vector<int> cpus;
+  std::stringstream ss(list);
+  std::string item;
+  while ( std::getline(ss, item, ',') ) {
+    if ( item.empty() ) continue;
+    std::string::size_type dash = item.find('-');
+    if ( dash == std::string::npos ) {
+      cpus.push_back( ::atoi(item.c_str()) );
+    } else {
+      int lo = ::atoi(item.substr(0, dash).c_str());
+      int hi = ::atoi(item.substr(dash+1).c_str());
+      for (int c = lo; c <= hi; ++c) cpus.push_back(c);
+    }
+  }
+  return cpus;
+}
+
+/*
+ * Parse uncore event encoding (e.g., "event=0x04,umask=0x03") into
+ * perf_event_attr config value.
+ */
+static uint64_t parseEventConfig(const std::string& encoding)
+{
+  uint64_t config = 0;
+  std::stringstream ss(encoding);
+  std::string item;
+  while ( std::getline(ss, item, ',') ) {
+    std::string::size_type eq = item.find('=');
+    if ( eq == std::string::npos ) continue;
+    std::string key = item.substr(0, eq);
+    uint64_t val = std::strtoull(item.substr(eq+1).c_str(), 0, 0);
+    if ( key == "event" ) {
+      config |= val;
+    } else if ( key == "umask" ) {
+      config |= (val << 8);
+    }
+  }
+  return config;
+}
+
+/*
+ * Open IMC read/write CAS counters on each uncore memory controller.
+ */
+static void openMemCounters()
+{
+  const std::string devdir("/sys/bus/event_source/devices/");
+
+  DIR* dir = opendir(devdir.c_str());
+  if ( !dir ) return;
+
+  struct dirent* entry;
+  while ( (entry = readdir(dir)) != 0 ) {
+    std::string dev(entry->d_name);
+    if ( dev.find("uncore_imc_") != 0 ) continue;
+
+    std::string path = devdir + dev;
+    std::string type = readSysFile(path + "/type");
+    std::vector<int> cpus = parseCpuList( readSysFile(path + "/cpumask") );
+    if ( type.empty() || cpus.empty() ) continue;
+
+    const std::string evname[2] = { "cas_count_read", "cas_count_write" };
+    const PerfCounterID cid[2] = { MemReadBytes, MemWriteBytes };
+
+    for (int ie = 0; ie < 2; ++ie) {
+      std::string enc = readSysFile(path + "/events/" + evname[ie]);
+      if ( enc.empty() ) continue;
+
+      // Scale converts counts to MiB; convert to bytes
+      std::string scale = readSysFile(path + "/events/" + evname[ie] +
+                                      ".scale");
+      counter_scale[cid[ie]] =
+        ( scale.empty() ? 64.0 : ::atof(scale.c_str()) * 1024.0 * 1024.0 );
+
+      for (size_t ic = 0; ic < cpus.size(); ++ic) {
+        int fd = openCounter( static_cast<uint32_t>(::atoi(type.c_str())),
+                              parseEventConfig(enc),
+                              -1, cpus[ic], false );
+        if ( fd >= 0 ) {
+          counter_fds[cid[ie]].push_back(fd);
+        }
+      }
+    }
+  }
+
+  closedir(dir);
+}
+
+bool initPerfCounters()
+{
+  finalizePerfCounters();
+
+  const uint64_t l1d_read_miss =
+    PERF_COUNT_HW_CACHE_L1D |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  const uint64_t dtlb_read_miss =
+    PERF_COUNT_HW_CACHE_DTLB |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+  const uint32_t core_type[] =
+    { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+      PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE };
+  const uint64_t core_config[] =
+    { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, l1d_read_miss,
+      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+      dtlb_read_miss };
+
+  int open_errno = 0;
+  for (int ic = Cycles; ic <= DTLBMisses; ++ic) {
+    int fd = openCounter(core_type[ic], core_config[ic], 0, -1, true);
+    if ( fd >= 0 ) {
+      counter_fds[ic].push_back(fd);
+      counter_scale[ic] = 1.0;
+    } else {
+      open_errno = errno;
+    }
+  }
+
+  openMemCounters();
+
+  bool have_any = false;
+  for (int ic = 0; ic < NumPerfCounters; ++ic) {
+    PerfCounterID cid = static_cast<PerfCounterID>(ic);
+    if ( havePerfCounter(cid) ) {
+      have_any = true;
+    } else {
+      std::cout << "\nHardware counter " << getPerfCounterName(cid)
+                << " is not available";
+    }
+  }
+  if ( open_errno != 0 ) {
+    std::cout << "\n  (perf_event_open: " << std::strerror(open_errno)
+              << "; check /proc/sys/kernel/perf_event_paranoid)";
+  }
+  std::cout << std::endl;
+
+  return have_any;
+}
+
+void finalizePerfCounters()
+{
+  for (int ic = 0; ic < NumPerfCounters; ++ic) {
+    for (size_t i = 0; i < counter_fds[ic].size(); ++i) {
+      close(counter_fds[ic][i]);
+    }
+    counter_fds[ic].clear();
+    counter_scale[ic] = 0.0;
+  }
+}
+
+void readPerfCounters(double vals[NumPerfCounters])
+{
+  for (int ic = 0; ic < NumPerfCounters; ++ic) {
+    vals[ic] = 0.0;
+    for (size_t i = 0; i < counter_fds[ic].size(); ++i) {
+      // value, time enabled, time running
+      uint64_t buf[3] = {0, 0, 0};
+      if ( read(counter_fds[ic][i], buf, sizeof(buf)) == sizeof(buf) ) {
+        double val = static_cast<double>(buf[0]);
+        if ( buf[2] > 0 && buf[2] < buf[1] ) {
+          val *= static_cast<double>(buf[1]) / buf[2];
+        }
+        vals[ic] += val * counter_scale[ic];
+      }
+    }
+  }
+}
+
+#else  // no perf_event_open on this system; all counters are unavailable
+
+bool initPerfCounters()
+{
+  std::cout << "\nHardware counters are only supported on Linux systems"
+            << std::endl;
+  return false;
+}
+
+void finalizePerfCounters()
+{
+}
+
+void readPerfCounters(double vals[NumPerfCounters])
+{
+  for (int ic = 0; ic < NumPerfCounters; ++ic) {
+    vals[ic] = 0.0;
+  }
+}
+
+#endif
+
+}  // closing brace for rajaperf namespace
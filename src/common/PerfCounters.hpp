@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for reading hardware performance counters around kernel runs.
+///
+/// Counters are read with the Linux perf_event_open interface. Core events
+/// are opened for the calling process with inheritance enabled, so they
+/// must be initialized before any threads (e.g., an OpenMP thread pool) are
+/// created for their counts to include those threads. Memory traffic is
+/// read from uncore memory controller (IMC) events when the system exposes
+/// them and permissions allow system-wide counting.
+///
+/// Any counter that cannot be opened (non-Linux system, container without
+/// perf access, unsupported event, etc.) is simply reported as unavailable.
+///
+
+#ifndef RAJAPerf_PerfCounters_HPP
+#define RAJAPerf_PerfCounters_HPP
+
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each hardware counter.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF COUNTER NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum PerfCounterID {
+
+  Cycles = 0,
+  Instructions,
+  L1DMisses,
+  LLCMisses,
+  BranchMisses,
+  DTLBMisses,
+  MemReadBytes,
+  MemWriteBytes,
+
+  NumPerfCounters // Keep this one last and DO NOT remove (!!)
+
+};
+
+/*!
+ * \brief Return name of counter associated with PerfCounterID enum value.
+ */
+const std::string& getPerfCounterName(PerfCounterID cid);
+
+/*!
+ * \brief Open all counters that are available on this system.
+ *
+ * Returns true if at least one counter is available.
+ */
+bool initPerfCounters();
+
+/*!
+ * \brief Close all open counters.
+ */
+void finalizePerfCounters();
+
+/*!
+ * \brief Return true if given counter was opened successfully.
+ */
+bool havePerfCounter(PerfCounterID cid);
+
+/*!
+ * \brief Read current value of all counters into given array.
+ *
+ * Values are cumulative since counters were initialized and are scaled
+ * for counter multiplexing. Unavailable counters are set to zero.
+ */
+void readPerfCounters(double vals[NumPerfCounters]);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
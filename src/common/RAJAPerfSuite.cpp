@@ -206,11 +206,58 @@ static const std::string VariantNames [] =
   std::string("RAJA_Seq"),
 #endif
 
+#if defined(RUN_SIMD)
+  std::string("Base_SIMD"),
+  std::string("RAJA_SIMD"),
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   std::string("Base_OpenMP"),
   std::string("RAJA_OpenMP"),
 #endif
 
+#if defined(RUN_TILED)
+  std::string("RAJA_Seq_Tiled"),
+  std::string("Base_Seq_TimeTiled"),
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  std::string("RAJA_OpenMP_Tiled"),
+  std::string("Base_OpenMP_TimeTiled"),
+#endif
+#endif
+
+#if defined(RUN_BATCHED)
+  std::string("Base_Seq_Batched"),
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  std::string("Base_OpenMP_Batched"),
+#endif
+#endif
+
+#if defined(RUN_LINE_SOLVE)
+  std::string("Base_Seq_Lines"),
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  std::string("Base_OpenMP_Lines"),
+  std::string("Base_OpenMP_Partition"),
+#endif
+#endif
+
+#if defined(RUN_FUSED)
+  std::string("Base_Seq_Fused"),
+  std::string("RAJA_Seq_Fused"),
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  std::string("Base_OpenMP_Fused"),
+  std::string("RAJA_OpenMP_Fused"),
+#endif
+#endif
+
+#if defined(RUN_THREADPOOL)
+  std::string("Base_ThreadPool"),
+  std::string("Lambda_ThreadPool"),
+#endif
+
+#if defined(RUN_STDPAR)
+  std::string("Base_StdPar"),
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)  
   std::string("Base_OMPTarget"),
   std::string("RAJA_OMPTarget"),
@@ -279,6 +326,63 @@ const std::string& getVariantName(VariantID vid)
   return VariantNames[vid];
 }
 
+/*
+ *******************************************************************************
+ *
+ * Return true if variant is a batched variant.
+ *
+ *******************************************************************************
+ */
+bool isBatchedVariant(VariantID vid)
+{
+#if defined(RUN_BATCHED)
+  if ( vid == Base_Seq_Batched ) return true;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP_Batched ) return true;
+#endif
+#endif
+  (void) vid;
+  return false;
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return true if variant is a time-tiled variant.
+ *
+ *******************************************************************************
+ */
+bool isTimeTiledVariant(VariantID vid)
+{
+#if defined(RUN_TILED)
+  if ( vid == Base_Seq_TimeTiled ) return true;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP_TimeTiled ) return true;
+#endif
+#endif
+  (void) vid;
+  return false;
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return true if variant is a fused variant.
+ *
+ *******************************************************************************
+ */
+bool isFusedVariant(VariantID vid)
+{
+#if defined(RUN_FUSED)
+  if ( vid == Base_Seq_Fused || vid == RAJA_Seq_Fused ) return true;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP_Fused || vid == RAJA_OpenMP_Fused ) return true;
+#endif
+#endif
+  (void) vid;
+  return false;
+}
+
 /*
  *******************************************************************************
  *
@@ -181,11 +181,58 @@ enum VariantID {
   RAJA_Seq,
 #endif
 
+#if defined(RUN_SIMD)
+  Base_SIMD,
+  RAJA_SIMD,
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   Base_OpenMP,
   RAJA_OpenMP,
 #endif
 
+#if defined(RUN_TILED)
+  RAJA_Seq_Tiled,
+  Base_Seq_TimeTiled,
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  RAJA_OpenMP_Tiled,
+  Base_OpenMP_TimeTiled,
+#endif
+#endif
+
+#if defined(RUN_BATCHED)
+  Base_Seq_Batched,
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  Base_OpenMP_Batched,
+#endif
+#endif
+
+#if defined(RUN_LINE_SOLVE)
+  Base_Seq_Lines,
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  Base_OpenMP_Lines,
+  Base_OpenMP_Partition,
+#endif
+#endif
+
+#if defined(RUN_FUSED)
+  Base_Seq_Fused,
+  RAJA_Seq_Fused,
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  Base_OpenMP_Fused,
+  RAJA_OpenMP_Fused,
+#endif
+#endif
+
+#if defined(RUN_THREADPOOL)
+  Base_ThreadPool,
+  Lambda_ThreadPool,
+#endif
+
+#if defined(RUN_STDPAR)
+  Base_StdPar,
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)  
   Base_OpenMPTarget,
   RAJA_OpenMPTarget,
@@ -241,6 +288,36 @@ const std::string& getFullKernelName(KernelID kid);
  */
 const std::string& getVariantName(VariantID vid); 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Return true if variant is a batched variant, which runs many 
+ *        independent instances of a kernel's problem in each rep.
+ *
+ *******************************************************************************
+ */
+bool isBatchedVariant(VariantID vid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return true if variant is a time-tiled variant, which runs blocks 
+ *        of time steps of a stencil kernel on each tile of its data.
+ *
+ *******************************************************************************
+ */
+bool isTimeTiledVariant(VariantID vid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return true if variant is a fused variant, which runs adjacent 
+ *        loops of a kernel in fewer passes over its data.
+ *
+ *******************************************************************************
+ */
+bool isFusedVariant(VariantID vid);
+
 /*!
  *******************************************************************************
  *
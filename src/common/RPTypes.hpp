@@ -16,12 +16,23 @@
 #include "RAJA/util/types.hpp"
 
 //
-// Only one of the following (double or float) should be defined.
+// Floating point precision is selected when the suite is configured 
+// (CMake option RAJA_PERFSUITE_PRECISION), which defines at most one of 
+// the following; double is used if none is defined.
+//
+//   RP_USE_DOUBLE -- data and reductions are double
+//   RP_USE_FLOAT  -- data and reductions are float
+//   RP_USE_MIXED  -- data is float, reductions accumulate in double
 // 
+#if !defined(RP_USE_DOUBLE) && !defined(RP_USE_FLOAT) && !defined(RP_USE_MIXED)
 #define RP_USE_DOUBLE
-//#undef RP_USE_DOUBLE
-//#define RP_USE_FLOAT
-#undef RP_USE_FLOAT
+#endif
+
+#if ( defined(RP_USE_DOUBLE) && defined(RP_USE_FLOAT) ) || \
+    ( defined(RP_USE_DOUBLE) && defined(RP_USE_MIXED) ) || \
+    ( defined(RP_USE_FLOAT) && defined(RP_USE_MIXED) )
+#error Only one of RP_USE_DOUBLE, RP_USE_FLOAT, RP_USE_MIXED may be defined!
+#endif
 
 #define RP_USE_COMPLEX
 //#undef RP_USE_COMPLEX
@@ -87,15 +98,34 @@ using Checksum_type = long double;
  *
  * \brief Floating point types used in kernels.
  *
+ * Real_type is the type of kernel data; Accum_type is the type of reduction 
+ * variables (e.g., sums) that kernels accumulate data values into.
+ *
  ******************************************************************************
  */
 #if defined(RP_USE_DOUBLE)
 ///
 using Real_type = double;
+///
+using Accum_type = double;
+
+#define RP_PRECISION_NAME "double"
 
 #elif defined(RP_USE_FLOAT)
 ///
 using Real_type = float;
+///
+using Accum_type = float;
+
+#define RP_PRECISION_NAME "float"
+
+#elif defined(RP_USE_MIXED)
+///
+using Real_type = float;
+///
+using Accum_type = double;
+
+#define RP_PRECISION_NAME "mixed"
 
 #else
 #error Real_type is undefined!
@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
+#include <sstream>
 
 namespace rajaperf
 {
@@ -28,9 +29,25 @@ namespace rajaperf
 RunParams::RunParams(int argc, char** argv)
  : input_state(Undefined),
    show_progress(false),
+   rep_timing(false),
+   perf_counters(false),
    npasses(1),
+   target_ci(0.0),
+   ci_max_time(10.0),
    rep_fact(1.0),
    size_fact(1.0),
+   size_sweep(),
+   thread_counts(),
+   thread_bind(NoBind),
+   data_placement(FirstTouch),
+   huge_pages(NoHugePages),
+   data_layout(SoA),
+   tile_size(default_tile_size),
+   register_block(default_register_block),
+   tune_tiles(false),
+   time_block(4),
+   batch_size(64),
+   data_pool(false),
    pf_tol(0.1),
    checkrun_reps(1),
    size_spec(Specundefined),
@@ -41,7 +58,8 @@ RunParams::RunParams(int argc, char** argv)
    variant_input(),
    invalid_variant_input(),
    outdir(),
-   outfile_prefix("RAJAPerf")
+   outfile_prefix("RAJAPerf"),
+   compare_to()
 {
   parseCommandLineOptions(argc, argv);
 }
@@ -69,15 +87,38 @@ RunParams::~RunParams()
 void RunParams::print(std::ostream& str) const
 {
   str << "\n show_progress = " << show_progress; 
+  str << "\n rep_timing = " << rep_timing; 
+  str << "\n perf_counters = " << perf_counters; 
   str << "\n npasses = " << npasses; 
+  str << "\n target_ci = " << target_ci; 
+  str << "\n ci_max_time = " << ci_max_time; 
   str << "\n rep_fact = " << rep_fact; 
   str << "\n size_fact = " << size_fact; 
+  str << "\n size_sweep = "; 
+  for (size_t j = 0; j < size_sweep.size(); ++j) {
+    str << ( j > 0 ? " " : "" ) << size_sweep[j];
+  }
+  str << "\n thread_counts = "; 
+  for (size_t j = 0; j < thread_counts.size(); ++j) {
+    str << ( j > 0 ? "," : "" ) << thread_counts[j];
+  }
+  str << "\n thread_bind = " << getThreadBindName(thread_bind); 
+  str << "\n data_placement = " << getDataPlacementName(data_placement); 
+  str << "\n huge_pages = " << getHugePageName(huge_pages); 
+  str << "\n data_layout = " << getDataLayoutName(data_layout); 
+  str << "\n tile_size = " << tile_size; 
+  str << "\n register_block = " << register_block; 
+  str << "\n tune_tiles = " << tune_tiles; 
+  str << "\n time_block = " << time_block; 
+  str << "\n batch_size = " << batch_size; 
+  str << "\n data_pool = " << data_pool; 
   str << "\n pf_tol = " << pf_tol; 
   str << "\n checkrun_reps = " << checkrun_reps; 
   str << "\n size_spec_string = " << size_spec_string;  
   str << "\n reference_variant = " << reference_variant; 
   str << "\n outdir = " << outdir; 
   str << "\n outfile_prefix = " << outfile_prefix; 
+  str << "\n compare_to = " << compare_to; 
 
   str << "\n kernel_input = "; 
   for (size_t j = 0; j < kernel_input.size(); ++j) {
@@ -126,6 +167,16 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
       show_progress = true;
 
+    } else if ( opt == std::string("--rep-timing") ||
+                opt == std::string("-rt") ) {
+
+      rep_timing = true;
+
+    } else if ( opt == std::string("--perf-counters") ||
+                opt == std::string("-pc") ) {
+
+      perf_counters = true;
+
     } else if ( opt == std::string("--print-kernels") ||
                 opt == std::string("-pk") ) {
      
@@ -150,6 +201,34 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--target-ci") ) {
+
+      i++;
+      if ( i < argc ) { 
+        std::string ci(argv[i]);
+        target_ci = ::atof( ci.c_str() );
+        if ( !ci.empty() && ci.at(ci.size()-1) == '%' ) {
+          target_ci /= 100.0;
+        }
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --target-ci a value (double or percentage)" 
+                  << std::endl;       
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ci-max-time") ) {
+
+      i++;
+      if ( i < argc ) { 
+        ci_max_time = ::atof( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --ci-max-time a value in seconds (double)" 
+                  << std::endl;       
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--repfact") ) {
 
       i++;
@@ -174,6 +253,191 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--size-sweep") ) {
+
+      i++;
+      double min_fact = 0.0;
+      double max_fact = 0.0;
+      double step_fact = 0.0;
+      if ( i < argc && 
+           sscanf(argv[i], "%lf:%lf:%lf", &min_fact, &max_fact, &step_fact) == 3 &&
+           min_fact > 0.0 && max_fact >= min_fact && step_fact > 1.0 ) {
+        size_sweep.clear();
+        // Small slack so max is included despite roundoff in products
+        for (double fact = min_fact; fact <= max_fact * (1.0 + 1.0e-9); 
+             fact *= step_fact) {
+          size_sweep.push_back(fact);
+        }
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --size-sweep a value min:max:factor"
+                  << " (doubles with 0 < min <= max and factor > 1)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--threads") ) {
+
+      i++;
+      thread_counts.clear();
+      bool good = ( i < argc && argv[i][0] != '-' );
+      if ( good ) {
+        std::stringstream ss(argv[i]);
+        std::string item;
+        while ( std::getline(ss, item, ',') ) {
+          int nthreads = ::atoi( item.c_str() );
+          good = good && ( nthreads > 0 );
+          thread_counts.push_back(nthreads);
+        }
+      }
+      if ( !good || thread_counts.empty() ) {
+        std::cout << "\nBad input:"
+                  << " must give --threads a comma-separated list of"
+                  << " thread counts (ints > 0)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--thread-bind") ) {
+
+      i++;
+      bool found_it = false;
+      for (int ib = 0; i < argc && ib < NumThreadBinds && !found_it; ++ib) {
+        ThreadBindID bid = static_cast<ThreadBindID>(ib);
+        if ( getThreadBindName(bid) == std::string(argv[i]) ) {
+          thread_bind = bid;
+          found_it = true;
+        }
+      }
+      if ( !found_it ) {
+        std::cout << "\nBad input:"
+                  << " must give --thread-bind one of: none, close, spread"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-placement") ||
+                opt == std::string("-dp") ) {
+
+      i++;
+      bool found_it = false;
+      for (int ip = 0; i < argc && ip < NumDataPlacements && !found_it; ++ip) {
+        DataPlacementID pid = static_cast<DataPlacementID>(ip);
+        if ( getDataPlacementName(pid) == std::string(argv[i]) ) {
+          data_placement = pid;
+          found_it = true;
+        }
+      }
+      if ( !found_it ) {
+        std::cout << "\nBad input:"
+                  << " must give --data-placement (or -dp) one of:"
+                  << " first-touch, interleave, local"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-layout") ||
+                opt == std::string("-dl") ) {
+
+      i++;
+      bool found_it = false;
+      for (int il = 0; i < argc && il < NumDataLayouts && !found_it; ++il) {
+        DataLayoutID lid = static_cast<DataLayoutID>(il);
+        if ( getDataLayoutName(lid) == std::string(argv[i]) ) {
+          data_layout = lid;
+          found_it = true;
+        }
+      }
+      if ( !found_it ) {
+        std::cout << "\nBad input:"
+                  << " must give --data-layout (or -dl) one of:"
+                  << " soa, aos, aosoa"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--tile-size") ||
+                opt == std::string("-ts") ) {
+
+      i++;
+      if ( i < argc && isTileSize( ::atoi(argv[i]) ) ) {
+        tile_size = ::atoi(argv[i]);
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --tile-size (or -ts) one of:"
+                  << " 16, 32, 64, 128"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--register-block") ||
+                opt == std::string("-rb") ) {
+
+      i++;
+      if ( i < argc && isRegisterBlock( ::atoi(argv[i]) ) ) {
+        register_block = ::atoi(argv[i]);
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --register-block (or -rb) one of:"
+                  << " 1, 2, 4"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--tune-tiles") ) {
+
+      tune_tiles = true;
+
+    } else if ( opt == std::string("--time-block") ||
+                opt == std::string("-tb") ) {
+
+      i++;
+      if ( i < argc && ::atoi(argv[i]) > 0 ) {
+        time_block = ::atoi(argv[i]);
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --time-block (or -tb) a positive value"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--batch-size") ||
+                opt == std::string("-bs") ) {
+
+      i++;
+      if ( i < argc && ::atoi(argv[i]) > 0 ) {
+        batch_size = ::atoi(argv[i]);
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --batch-size (or -bs) a positive value"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-pool") ) {
+
+      data_pool = true;
+
+    } else if ( opt == std::string("--huge-pages") ||
+                opt == std::string("-hp") ) {
+
+      i++;
+      bool found_it = false;
+      for (int ih = 0; i < argc && ih < NumHugePageModes && !found_it; ++ih) {
+        HugePageID hid = static_cast<HugePageID>(ih);
+        if ( getHugePageName(hid) == std::string(argv[i]) ) {
+          huge_pages = hid;
+          found_it = true;
+        }
+      }
+      if ( !found_it ) {
+        std::cout << "\nBad input:"
+                  << " must give --huge-pages (or -hp) one of:"
+                  << " none, thp, explicit"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if (opt == std::string("--sizespec") ) {
       i++;
       if ( i < argc ) {
@@ -255,6 +519,19 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( std::string(argv[i]) == std::string("--compare-to") ) {
+
+      i++;
+      if ( i < argc && argv[i][0] != '-' ) {
+        compare_to = std::string( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --compare-to a previous run's JSON report"
+                  << " file or output directory"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( std::string(argv[i]) == std::string("--refvar") ||
                 std::string(argv[i]) == std::string("-rv") ) {
 
@@ -298,6 +575,21 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
     }
 
   }
+
+  //
+  // A size sweep runs each kernel at the sweep sizes only and writes only
+  // the sweep report, so options for other runs and reports can't be used
+  // with it.
+  //
+  if ( !size_sweep.empty() && 
+       ( !thread_counts.empty() || target_ci > 0.0 || 
+         !compare_to.empty() ) ) {
+    std::cout << "\nBad input:"
+              << " --size-sweep can't be used with --threads, --target-ci,"
+              << " or --compare-to"
+              << std::endl;
+    input_state = BadInput;
+  }
 }
 
 
@@ -310,6 +602,13 @@ void RunParams::printHelpMessage(std::ostream& str) const
 
   str << "\t --show-progress, -sp (print progress during run}\n\n";
 
+  str << "\t --rep-timing, -rt (time each kernel rep separately and report\n"
+      << "\t      median, 5th/95th percentiles, MAD, and coefficient of\n"
+      << "\t      variation of rep times in timing report)\n\n";
+
+  str << "\t --perf-counters, -pc (read hardware performance counters\n"
+      << "\t      around each kernel and write counter report; Linux only)\n\n";
+
   str << "\t --print-kernels, -pk (print valid kernel names}\n\n";
 
   str << "\t --print-variants, -pv (print valid variant names}\n\n";
@@ -319,24 +618,135 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --npasses 2 (runs complete suite twice\n\n";
 
+  str << "\t --target-ci <double or percentage> [default is 0; i.e., off]\n"
+      << "\t      (run passes of each kernel variant until half-width of 95%\n"
+      << "\t       confidence interval of its time is within given fraction\n"
+      << "\t       of mean time; --npasses gives minimum number of passes)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --target-ci 2% (stop when 95% CI is within +/-2% of mean)\n"
+      << "\t\t --target-ci 0.05 (stop when 95% CI is within +/-5% of mean)\n\n";
+
+  str << "\t --ci-max-time <double> [default is 10.0]\n"
+      << "\t      (max time in seconds spent running passes of each kernel\n"
+      << "\t       variant to reach --target-ci)\n\n";
+
   str << "\t --repfact <double> [default is 1.0]\n"
       << "\t      (fraction of default # reps to run each kernel)\n";
   str << "\t\t Example...\n"
       << "\t\t --repfact 0.5 (runs kernels 1/2 as many times as default)\n\n";
 
   str << "\t --sizefact <double> [default is 1.0]\n"
-      << "\t      (fraction of default kernel iteration space size to run)\n";
+      << "\t      (fraction of default kernel iteration space size to run;\n"
+      << "\t       Polybench kernels scale each dimension so their data size\n"
+      << "\t       grows by this factor)\n";
   str << "\t\t Example...\n"
       << "\t\t --sizefact 2.0 (iteration space size is twice the default)\n\n";
 
+  str << "\t --size-sweep <min:max:factor> [default is no sweep]\n"
+      << "\t      (run each kernel at size factors min, min*factor, ... up to\n"
+      << "\t       max, relative to --sizefact, and report throughput vs.\n"
+      << "\t       working set size; reps are scaled inversely to size;\n"
+      << "\t       only the sweep report is written, and --threads,\n"
+      << "\t       --target-ci, and --compare-to can't be given with it)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --size-sweep 0.001:4:2 (run sizes from 1/1000 to 4 times default, doubling each time)\n\n";
+
+  str << "\t --threads <comma-separated ints> [default is none]\n"
+      << "\t      (after suite is run, re-run OpenMP and thread pool variants with\n"
+      << "\t       each number of threads and report strong-scaling speedup and\n"
+      << "\t       efficiency)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --threads 1,2,4,8,16 (run OpenMP variants with 1, 2, ..., 16 threads)\n\n";
+
+  str << "\t --thread-bind <string> [one of : none,close,spread -- default is none]\n"
+      << "\t      (bind OpenMP and thread pool threads to consecutive cpus\n"
+      << "\t       (close) or to cpus evenly spaced over those available (spread))\n";
+  str << "\t\t Example...\n"
+      << "\t\t --threads 1,2,4 --thread-bind spread (split threads across sockets)\n\n";
+
+  str << "\t --data-placement, -dp <string> [one of : first-touch,interleave,local -- default is first-touch]\n"
+      << "\t      (placement of kernel data pages on NUMA nodes: on node of\n"
+      << "\t       thread that first writes them, with OpenMP variant data\n"
+      << "\t       written in parallel; interleaved over all nodes; or all on\n"
+      << "\t       node that runs suite driver)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -dp interleave (interleave data pages over all NUMA nodes)\n\n";
+
+  str << "\t --data-layout, -dl <string> [one of : soa,aos,aosoa -- default is soa]\n"
+      << "\t      (layout of field arrays of kernels that have several arrays\n"
+      << "\t       of the same length, e.g. VOL3D, ENERGY, HYDRO_2D, and\n"
+      << "\t       DEL_DOT_VEC_2D, in sequential and OpenMP variants: separate\n"
+      << "\t       arrays; fields of each element adjacent; or fields\n"
+      << "\t       contiguous in blocks of elements)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -dl aos (interleave fields of each element)\n\n";
+
+  str << "\t --tile-size, -ts <int> [one of : 16,32,64,128 -- default is 32]\n"
+      << "\t      (rows and columns of tiles in tiled variants of polybench\n"
+      << "\t       matrix kernels, RAJA_Seq_Tiled and RAJA_OpenMP_Tiled)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -ts 64 (use 64x64 tiles)\n\n";
+
+  str << "\t --register-block, -rb <int> [one of : 1,2,4 -- default is 4]\n"
+      << "\t      (matrix rows updated together in innermost loop of tiled\n"
+      << "\t       variants, so each value of the other operand loaded is\n"
+      << "\t       used that many times)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -rb 2 (update two rows at a time)\n\n";
+
+  str << "\t --tune-tiles (before running each tiled variant, time it with\n"
+      << "\t      each tile size and register block and use the fastest;\n"
+      << "\t      choices are given in the tiles report and JSON file)\n\n";
+
+  str << "\t --time-block, -tb <int> [default is 4]\n"
+      << "\t      (time steps run on each tile of rows while it is in cache\n"
+      << "\t       in time-tiled variants of polybench stencil kernels,\n"
+      << "\t       Base_Seq_TimeTiled and Base_OpenMP_TimeTiled)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -tb 8 (run 8 time steps on each tile)\n\n";
+
+  str << "\t --batch-size, -bs <int> [default is 64]\n"
+      << "\t      (independent problem instances solved in each rep by\n"
+      << "\t       batched variants of polybench kernels at Mini and Small\n"
+      << "\t       sizes, Base_Seq_Batched and Base_OpenMP_Batched)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -bs 1000 (solve 1000 instances per rep)\n\n";
+
+  str << "\t --huge-pages, -hp <string> [one of : none,thp,explicit -- default is none]\n"
+      << "\t      (back kernel data arrays of 2MB or more with 2MB huge pages:\n"
+      << "\t       transparent huge pages via madvise, or pages reserved in\n"
+      << "\t       /proc/sys/vm/nr_hugepages via mmap; compare runs with and\n"
+      << "\t       without to see TLB miss cost, e.g. with -pc)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -hp thp (use transparent huge pages for large arrays)\n\n";
+
+  str << "\t --data-pool (reuse kernel data arrays across variants of each\n"
+      << "\t      kernel rather than allocating them for each variant run;\n"
+      << "\t      arrays keep pages faulted in and placed by first variant\n"
+      << "\t      that used them; arrays are reused only by variants that\n"
+      << "\t      first touch data the same way: serially, by OpenMP threads,\n"
+      << "\t      or by thread pool threads)\n\n";
+
   str << "\t --sizespec <string> [one of : mini,small,medium,large,extralarge (anycase) -- default is medium]\n"
       << "\t      (used to set specific sizes for polybench kernels)\n\n"; 
 
   str << "\t --pass-fail-tol, -pftol <double> [default is 0.1; i.e., 10%]\n"
-      << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report)\n";
+      << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report,\n"
+      << "\t       and for kernel variants vs. previous run with --compare-to)\n";
   str << "\t\t Example...\n"
       << "\t\t -pftol 0.2 (RAJA kernel variants that run 20% or more slower than Base variants will be reported as OVER_TOL in FOM report)\n\n";
 
+  str << "\t --compare-to <string> [Default is none]\n"
+      << "\t      (JSON report file, or output directory holding one with the\n"
+      << "\t       same file prefix, of a previous run to compare timings to;\n"
+      << "\t       kernel variants that run significantly slower by more than\n"
+      << "\t       --pass-fail-tol are reported as REGRESSED and the suite exits\n"
+      << "\t       with nonzero status. Kernels and variants of the previous run\n"
+      << "\t       are run if none are given)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --compare-to old/RAJAPerf.json (compare to run in old directory)\n"
+      << "\t\t --compare-to old -np 10 (same, with 10 passes for significance)\n\n";
+
   str << "\t --outdir, -od <string> [Default is current directory]\n"
       << "\t      (directory path for output data files)\n";
   str << "\t\t Examples...\n"
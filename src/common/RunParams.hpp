@@ -15,6 +15,8 @@
 
 
 #include "common/DataUtils.hpp"
+#include "common/ThreadUtils.hpp"
+#include "common/TileConfig.hpp"
 
 namespace rajaperf
 {
@@ -64,11 +66,45 @@ public:
 
   bool showProgress() const { return show_progress; }
 
+  bool useRepTiming() const { return rep_timing; }
+
+  bool usePerfCounters() const { return perf_counters; }
+
   int getNumPasses() const { return npasses; }
 
+  double getTargetCI() const { return target_ci; }
+
+  double getCIMaxTime() const { return ci_max_time; }
+
   double getRepFactor() const { return rep_fact; }
+  void setRepFactor(double fact) { rep_fact = fact; }
 
   double getSizeFactor() const { return size_fact; }
+  void setSizeFactor(double fact) { size_fact = fact; }
+
+  const std::vector<double>& getSizeSweep() const { return size_sweep; }
+
+  const std::vector<int>& getThreadCounts() const { return thread_counts; }
+
+  ThreadBindID getThreadBind() const { return thread_bind; }
+
+  DataPlacementID getDataPlacement() const { return data_placement; }
+
+  HugePageID getHugePages() const { return huge_pages; }
+
+  DataLayoutID getDataLayout() const { return data_layout; }
+
+  Index_type getTileSize() const { return tile_size; }
+
+  Index_type getRegisterBlock() const { return register_block; }
+
+  bool tuneTiles() const { return tune_tiles; }
+
+  Index_type getTimeBlock() const { return time_block; }
+
+  Index_type getBatchSize() const { return batch_size; }
+
+  bool useDataPool() const { return data_pool; }
 
   SizeSpec  getSizeSpec() const { return size_spec; }
 
@@ -99,6 +135,8 @@ public:
   const std::string& getOutputDirName() const { return outdir; }
   const std::string& getOutputFilePrefix() const { return outfile_prefix; }
 
+  const std::string& getCompareTo() const { return compare_to; }
+
 //@}
 
   /*!
@@ -124,9 +162,50 @@ private:
 
   bool show_progress;    /*!< true -> show run progress; false -> do not */
 
+  bool rep_timing;       /*!< true -> time each kernel rep separately and 
+                              report timing distribution; false -> do not */
+
+  bool perf_counters;    /*!< true -> read hardware counters around each 
+                              timed kernel region; false -> do not */
+
   int npasses;           /*!< Number of passes through suite  */
+  double target_ci;      /*!< relative half-width of 95% confidence interval
+                              of kernel variant times at which to stop 
+                              running passes (0 -> run npasses passes) */
+  double ci_max_time;    /*!< max time (sec) to spend running passes of
+                              each kernel variant to reach target_ci */
   double rep_fact;       /*!< pct of default kernel reps to run */
   double size_fact;      /*!< pct of default kernel iteration space to run */
+  std::vector<double> size_sweep;  /*!< size factors (relative to size_fact)
+                                        at which to run each kernel in a 
+                                        size sweep (empty -> no sweep) */
+  std::vector<int> thread_counts;  /*!< thread counts at which to re-run
+                                        OpenMP variants (empty -> none) */
+  ThreadBindID thread_bind;  /*!< how to bind OpenMP threads to cpus */
+
+  DataPlacementID data_placement;  /*!< how to place pages of kernel data
+                                        on NUMA nodes */
+
+  HugePageID huge_pages;  /*!< whether to back large kernel data arrays
+                               with huge pages, and which kind */
+
+  DataLayoutID data_layout;  /*!< layout of field arrays of kernels that
+                                  define layouts */
+
+  Index_type tile_size;       /*!< tile size of tiled kernel variants */
+  Index_type register_block;  /*!< rows done together in innermost loop 
+                                   of tiled kernel variants */
+  bool tune_tiles;       /*!< true -> pick tile size and register block of
+                              each tiled kernel variant by timing each one
+                              before it runs; false -> use those above */
+  Index_type time_block;  /*!< time steps run on each tile in time-tiled 
+                               variants of stencil kernels */
+  Index_type batch_size;  /*!< problem instances run in each rep by batched
+                               kernel variants */
+
+  bool data_pool;        /*!< true if kernel data arrays are reused across
+                              variants of each kernel */
+
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
 
@@ -151,6 +230,9 @@ private:
   std::string outdir;          /*!< Output directory name. */
   std::string outfile_prefix;  /*!< Prefix for output data file names. */
 
+  std::string compare_to;  /*!< JSON report file (or directory holding one)
+                                of previous run to check for regressions */
+
 };
 
 
@@ -0,0 +1,224 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Thin wrapper over x86 SIMD intrinsics used by Base_SIMD kernel variants.
+///
+/// The widest instruction set the compiler targets is used (AVX-512F, AVX,
+/// or SSE2, e.g., as selected with -march); otherwise, vectors have one
+/// element and Base_SIMD variants run as scalar loops. Vectors hold
+/// simd_width values of Real_type (float or double).
+///
+/// Base_SIMD loops process simd_width iterations at a time with the
+/// operations below and finish the remaining iterations with the scalar
+/// kernel body. Operations are done in the same order as in the scalar
+/// body so results match other variants, except that reductions keep a
+/// partial sum in each vector lane (as OpenMP reductions keep one for
+/// each thread).
+///
+
+#ifndef RAJAPerf_SIMDUtils_HPP
+#define RAJAPerf_SIMDUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <cmath>
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+//
+// Select vector type and intrinsic name for each operation.
+//
+#if defined(RP_USE_DOUBLE)
+#define RAJAPERF_SIMD_SUFFIX pd
+#else
+#define RAJAPERF_SIMD_SUFFIX ps
+#endif
+
+#define RAJAPERF_SIMD_CAT_(a, b, c) a##b##c
+#define RAJAPERF_SIMD_CAT(a, b, c) RAJAPERF_SIMD_CAT_(a, b, c)
+
+#if defined(__AVX512F__)
+#define RAJAPERF_SIMD_ISA "AVX-512"
+#define RAJAPERF_SIMD_OP(op) RAJAPERF_SIMD_CAT(_mm512_, op##_, RAJAPERF_SIMD_SUFFIX)
+#if defined(RP_USE_DOUBLE)
+typedef __m512d rajaperf_simd_native;
+#else
+typedef __m512 rajaperf_simd_native;
+#endif
+
+#elif defined(__AVX__)
+#if defined(__AVX2__)
+#define RAJAPERF_SIMD_ISA "AVX2"
+#else
+#define RAJAPERF_SIMD_ISA "AVX"
+#endif
+#define RAJAPERF_SIMD_OP(op) RAJAPERF_SIMD_CAT(_mm256_, op##_, RAJAPERF_SIMD_SUFFIX)
+#if defined(RP_USE_DOUBLE)
+typedef __m256d rajaperf_simd_native;
+#else
+typedef __m256 rajaperf_simd_native;
+#endif
+
+#elif defined(__SSE2__)
+#define RAJAPERF_SIMD_ISA "SSE2"
+#define RAJAPERF_SIMD_OP(op) RAJAPERF_SIMD_CAT(_mm_, op##_, RAJAPERF_SIMD_SUFFIX)
+#if defined(RP_USE_DOUBLE)
+typedef __m128d rajaperf_simd_native;
+#else
+typedef __m128 rajaperf_simd_native;
+#endif
+
+#else
+#define RAJAPERF_SIMD_ISA "scalar"
+#define RAJAPERF_SIMD_SCALAR
+
+#endif
+
+
+namespace rajaperf
+{
+
+#if defined(RAJAPERF_SIMD_SCALAR)
+
+/*!
+ * \brief Vector of simd_width Real_type values (one, with no vector ISA).
+ */
+struct SIMDReal
+{
+  Real_type v;
+};
+
+const Index_type simd_width = 1;
+
+inline SIMDReal simdSet1(Real_type a) { SIMDReal r = { a }; return r; }
+inline SIMDReal simdLoad(const Real_type* p) { SIMDReal r = { *p }; return r; }
+inline void simdStore(Real_type* p, SIMDReal a) { *p = a.v; }
+
+inline SIMDReal operator+(SIMDReal a, SIMDReal b) { return simdSet1(a.v + b.v); }
+inline SIMDReal operator-(SIMDReal a, SIMDReal b) { return simdSet1(a.v - b.v); }
+inline SIMDReal operator*(SIMDReal a, SIMDReal b) { return simdSet1(a.v * b.v); }
+inline SIMDReal operator/(SIMDReal a, SIMDReal b) { return simdSet1(a.v / b.v); }
+
+inline SIMDReal simdSqrt(SIMDReal a) { return simdSet1( std::sqrt(a.v) ); }
+
+/*!
+ * \brief Return a where s >= 0 and b elsewhere.
+ */
+inline SIMDReal simdSelectNonNeg(SIMDReal s, SIMDReal a, SIMDReal b)
+{
+  return ( s.v >= 0 ? a : b );
+}
+
+#else
+
+struct SIMDReal
+{
+  rajaperf_simd_native v;
+};
+
+const Index_type simd_width =
+  static_cast<Index_type>( sizeof(rajaperf_simd_native) / sizeof(Real_type) );
+
+inline SIMDReal simdMake(rajaperf_simd_native a) { SIMDReal r = { a }; return r; }
+
+inline SIMDReal simdSet1(Real_type a)
+  { return simdMake( RAJAPERF_SIMD_OP(set1)(a) ); }
+inline SIMDReal simdLoad(const Real_type* p)
+  { return simdMake( RAJAPERF_SIMD_OP(loadu)(p) ); }
+inline void simdStore(Real_type* p, SIMDReal a)
+  { RAJAPERF_SIMD_OP(storeu)(p, a.v); }
+
+inline SIMDReal operator+(SIMDReal a, SIMDReal b)
+  { return simdMake( RAJAPERF_SIMD_OP(add)(a.v, b.v) ); }
+inline SIMDReal operator-(SIMDReal a, SIMDReal b)
+  { return simdMake( RAJAPERF_SIMD_OP(sub)(a.v, b.v) ); }
+inline SIMDReal operator*(SIMDReal a, SIMDReal b)
+  { return simdMake( RAJAPERF_SIMD_OP(mul)(a.v, b.v) ); }
+inline SIMDReal operator/(SIMDReal a, SIMDReal b)
+  { return simdMake( RAJAPERF_SIMD_OP(div)(a.v, b.v) ); }
+
+inline SIMDReal simdSqrt(SIMDReal a)
+  { return simdMake( RAJAPERF_SIMD_OP(sqrt)(a.v) ); }
+
+/*!
+ * \brief Return a where s >= 0 and b elsewhere.
+ */
+inline SIMDReal simdSelectNonNeg(SIMDReal s, SIMDReal a, SIMDReal b)
+{
+  const rajaperf_simd_native zero = RAJAPERF_SIMD_OP(setzero)();
+#if defined(__AVX512F__)
+  return simdMake( RAJAPERF_SIMD_OP(mask_blend)(
+           RAJAPERF_SIMD_CAT(_mm512_cmp_, RAJAPERF_SIMD_SUFFIX, _mask)(
+             s.v, zero, _CMP_GE_OQ), 
+           b.v, a.v) );
+#elif defined(__AVX__)
+  return simdMake( RAJAPERF_SIMD_OP(blendv)(
+           b.v, a.v, RAJAPERF_SIMD_OP(cmp)(s.v, zero, _CMP_GE_OQ)) );
+#else
+  const rajaperf_simd_native mask = RAJAPERF_SIMD_OP(cmpge)(s.v, zero);
+  return simdMake( RAJAPERF_SIMD_CAT(_mm_, or_, RAJAPERF_SIMD_SUFFIX)(
+                     RAJAPERF_SIMD_CAT(_mm_, and_, RAJAPERF_SIMD_SUFFIX)(mask, a.v),
+                     RAJAPERF_SIMD_CAT(_mm_, andnot_, RAJAPERF_SIMD_SUFFIX)(mask, b.v)) );
+#endif
+}
+
+#endif
+
+/*!
+ * \brief Apply scalar function to each value of vector (for operations
+ *        with no vector instruction, e.g., exp).
+ */
+template <typename FUNC>
+inline SIMDReal simdApply(SIMDReal a, FUNC func)
+{
+  Real_type vals[simd_width];
+  simdStore(vals, a);
+  for (Index_type j = 0; j < simd_width; ++j) {
+    vals[j] = func(vals[j]);
+  }
+  return simdLoad(vals);
+}
+
+/*!
+ * \brief Add values of vector to scalar sum, in order.
+ */
+inline void simdAddTo(Accum_type& sum, SIMDReal a)
+{
+  Real_type vals[simd_width];
+  simdStore(vals, a);
+  for (Index_type j = 0; j < simd_width; ++j) {
+    sum += vals[j];
+  }
+}
+
+/*!
+ * \brief Return vector with values base, base+1, ..., base+simd_width-1.
+ */
+inline SIMDReal simdIota(Index_type base)
+{
+  Real_type vals[simd_width];
+  for (Index_type j = 0; j < simd_width; ++j) {
+    vals[j] = static_cast<Real_type>(base + j);
+  }
+  return simdLoad(vals);
+}
+
+/*!
+ * \brief Return name of instruction set and number of Real_type values
+ *        in vectors used by Base_SIMD variants.
+ */
+inline const char* getSIMDISAName() { return RAJAPERF_SIMD_ISA; }
+///
+inline Index_type getSIMDWidth() { return simd_width; }
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
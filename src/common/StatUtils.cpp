@@ -0,0 +1,176 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "StatUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+
+/*
+ * Two-sided 95% critical values of Student's t distribution for 1 to 30
+ * degrees of freedom. Normal value is used beyond that.
+ */
+static const double t_crit_95[] = 
+{
+  12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+
+/*
+ * Return two-sided 95% critical value of Student's t distribution for
+ * given degrees of freedom, which are rounded down so the test stays
+ * conservative for fractional (Welch) degrees of freedom.
+ */
+double getTCritical95(double dof)
+{
+  if ( dof < 1.0 ) {
+    return t_crit_95[0];
+  }
+  size_t idof = static_cast<size_t>( std::floor(dof) );
+  return ( idof <= 30 ? t_crit_95[idof - 1] : 1.960 );
+}
+
+/*
+ * Return arithmetic mean of samples.
+ */
+double calcMean(const std::vector<double>& samples)
+{
+  if ( samples.empty() ) {
+    return 0.0;
+  }
+
+  double sum = 0.0;
+  for (size_t i = 0; i < samples.size(); ++i) {
+    sum += samples[i];
+  }
+  return sum / samples.size();
+}
+
+/*
+ * Return sample standard deviation of samples.
+ */
+double calcStdDev(const std::vector<double>& samples)
+{
+  if ( samples.size() < 2 ) {
+    return 0.0;
+  }
+
+  double mean = calcMean(samples);
+  double sumsq = 0.0;
+  for (size_t i = 0; i < samples.size(); ++i) {
+    sumsq += (samples[i] - mean) * (samples[i] - mean);
+  }
+  return std::sqrt( sumsq / (samples.size() - 1) );
+}
+
+/*
+ * Return coefficient of variation of samples.
+ */
+double calcCoeffOfVariation(const std::vector<double>& samples)
+{
+  double mean = calcMean(samples);
+  if ( mean == 0.0 ) {
+    return 0.0;
+  }
+  return calcStdDev(samples) / mean;
+}
+
+/*
+ * Return half-width of 95% confidence interval for mean of samples.
+ */
+double calcConfIntervalHalfWidth95(const std::vector<double>& samples)
+{
+  if ( samples.size() < 2 ) {
+    return 0.0;
+  }
+
+  double t_crit = getTCritical95( double(samples.size() - 1) );
+
+  return t_crit * calcStdDev(samples) / std::sqrt( double(samples.size()) );
+}
+
+/*
+ * Return Welch's t statistic for difference of means of two sample sets
+ * and set Welch-Satterthwaite degrees of freedom.
+ */
+double calcWelchT(const std::vector<double>& samples_a,
+                  const std::vector<double>& samples_b,
+                  double& dof)
+{
+  dof = 0.0;
+  if ( samples_a.size() < 2 || samples_b.size() < 2 ) {
+    return 0.0;
+  }
+
+  double na = double(samples_a.size());
+  double nb = double(samples_b.size());
+  double sa = calcStdDev(samples_a);
+  double sb = calcStdDev(samples_b);
+  double va = sa * sa / na;
+  double vb = sb * sb / nb;
+
+  double diff = calcMean(samples_b) - calcMean(samples_a);
+  if ( va + vb == 0.0 ) {
+    // No spread in either set; any difference is exact
+    dof = na + nb - 2.0;
+    return ( diff == 0.0 ? 0.0 : 
+             ( diff > 0.0 ? HUGE_VAL : -HUGE_VAL ) );
+  }
+
+  dof = (va + vb) * (va + vb) /
+        ( va * va / (na - 1.0) + vb * vb / (nb - 1.0) );
+
+  return diff / std::sqrt(va + vb);
+}
+
+/*
+ * Return given percentile of sorted samples.
+ */
+double calcPercentile(const std::vector<double>& sorted_samples, double pct)
+{
+  if ( sorted_samples.empty() ) {
+    return 0.0;
+  }
+
+  double rank = (pct / 100.0) * (sorted_samples.size() - 1);
+  size_t lo = static_cast<size_t>( std::floor(rank) );
+  size_t hi = std::min(lo + 1, sorted_samples.size() - 1);
+  double frac = rank - lo;
+
+  return sorted_samples[lo] + frac * (sorted_samples[hi] - sorted_samples[lo]);
+}
+
+/*
+ * Return median of sorted samples.
+ */
+double calcMedian(const std::vector<double>& sorted_samples)
+{
+  return calcPercentile(sorted_samples, 50.0);
+}
+
+/*
+ * Return median absolute deviation of sorted samples.
+ */
+double calcMedianAbsDev(const std::vector<double>& sorted_samples)
+{
+  double median = calcMedian(sorted_samples);
+
+  std::vector<double> absdev(sorted_samples.size());
+  for (size_t i = 0; i < sorted_samples.size(); ++i) {
+    absdev[i] = std::abs(sorted_samples[i] - median);
+  }
+  std::sort(absdev.begin(), absdev.end());
+
+  return calcMedian(absdev);
+}
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for computing summary statistics of timing samples.
+///
+
+#ifndef RAJAPerf_StatUtils_HPP
+#define RAJAPerf_StatUtils_HPP
+
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Return arithmetic mean of samples (0.0 if no samples).
+ */
+double calcMean(const std::vector<double>& samples);
+
+/*!
+ * \brief Return sample standard deviation of samples
+ *        (0.0 if fewer than two samples).
+ */
+double calcStdDev(const std::vector<double>& samples);
+
+/*!
+ * \brief Return coefficient of variation (std dev / mean) of samples.
+ */
+double calcCoeffOfVariation(const std::vector<double>& samples);
+
+/*!
+ * \brief Return half-width of two-sided 95% confidence interval for the
+ *        mean of samples, using Student's t distribution
+ *        (0.0 if fewer than two samples).
+ */
+double calcConfIntervalHalfWidth95(const std::vector<double>& samples);
+
+/*!
+ * \brief Return two-sided 95% critical value of Student's t distribution
+ *        for given (possibly fractional) degrees of freedom.
+ */
+double getTCritical95(double dof);
+
+/*!
+ * \brief Return Welch's t statistic for the difference of means of two
+ *        sample sets (mean of b minus mean of a), which need not have
+ *        equal size or variance.
+ *
+ * Welch-Satterthwaite degrees of freedom are returned in dof. Returns 0.0
+ * and sets dof to 0.0 if either set has fewer than two samples.
+ */
+double calcWelchT(const std::vector<double>& samples_a,
+                  const std::vector<double>& samples_b,
+                  double& dof);
+
+/*!
+ * \brief Return given percentile (in [0, 100]) of samples.
+ *
+ * Samples must be sorted in ascending order. Percentile is computed by
+ * linear interpolation between closest ranks.
+ */
+double calcPercentile(const std::vector<double>& sorted_samples, double pct);
+
+/*!
+ * \brief Return median of samples, which must be sorted in ascending order.
+ */
+double calcMedian(const std::vector<double>& sorted_samples);
+
+/*!
+ * \brief Return median absolute deviation (about the median) of samples,
+ *        which must be sorted in ascending order.
+ */
+double calcMedianAbsDev(const std::vector<double>& sorted_samples);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
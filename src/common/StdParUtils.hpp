@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Types used by Base_StdPar kernel variants, which run kernel bodies with
+/// C++17 parallel algorithms (std::for_each, std::transform_reduce) and
+/// the std::execution::par_unseq policy.
+///
+/// Only the Foo-StdPar.cpp files that implement those variants include
+/// this header; they are compiled as C++17 while the rest of the suite
+/// is C++11.
+///
+
+#ifndef RAJAPerf_StdParUtils_HPP
+#define RAJAPerf_StdParUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <numeric>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Random access iterator over loop index values.
+ *
+ * Parallel algorithms run a kernel body for each index i in [ibegin, iend)
+ * with IndexIterator(ibegin), IndexIterator(iend), so no array of indices
+ * is stored in memory (C++17 has no std::views::iota).
+ */
+class IndexIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = Index_type;
+  using difference_type = Index_type;
+  using pointer = const Index_type*;
+  using reference = Index_type;
+
+  IndexIterator() : m_i(0) { }
+  explicit IndexIterator(Index_type i) : m_i(i) { }
+
+  reference operator*() const { return m_i; }
+  reference operator[](difference_type n) const { return m_i + n; }
+
+  IndexIterator& operator++() { ++m_i; return *this; }
+  IndexIterator& operator--() { --m_i; return *this; }
+  IndexIterator operator++(int) { IndexIterator it(*this); ++m_i; return it; }
+  IndexIterator operator--(int) { IndexIterator it(*this); --m_i; return it; }
+
+  IndexIterator& operator+=(difference_type n) { m_i += n; return *this; }
+  IndexIterator& operator-=(difference_type n) { m_i -= n; return *this; }
+
+  IndexIterator operator+(difference_type n) const
+    { return IndexIterator(m_i + n); }
+  IndexIterator operator-(difference_type n) const
+    { return IndexIterator(m_i - n); }
+  difference_type operator-(const IndexIterator& other) const
+    { return m_i - other.m_i; }
+
+  bool operator==(const IndexIterator& other) const { return m_i == other.m_i; }
+  bool operator!=(const IndexIterator& other) const { return m_i != other.m_i; }
+  bool operator<(const IndexIterator& other) const { return m_i < other.m_i; }
+  bool operator>(const IndexIterator& other) const { return m_i > other.m_i; }
+  bool operator<=(const IndexIterator& other) const { return m_i <= other.m_i; }
+  bool operator>=(const IndexIterator& other) const { return m_i >= other.m_i; }
+
+private:
+  Index_type m_i;
+};
+
+inline IndexIterator operator+(IndexIterator::difference_type n,
+                               const IndexIterator& it)
+{
+  return it + n;
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,347 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ThreadPool.hpp"
+
+#if defined(RUN_THREADPOOL)
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace rajaperf
+{
+
+/*
+ * Number of chunks each thread gets at the start of a loop, so there are
+ * chunks left to steal when threads finish their share at different times,
+ * and fewest iterations in a chunk, so chunk overhead stays small compared
+ * to the work in it.
+ */
+static const Index_type chunks_per_thread = 8;
+static const Index_type min_chunk_length = 64;
+
+/*
+ * Number of times an idle worker checks for a new loop before it sleeps,
+ * if there is a cpu for each thread; otherwise, spinning threads would
+ * take cpu time from threads with work, so idle threads sleep (or yield) 
+ * at once.
+ */
+static const int idle_spins = 1 << 16;
+
+static inline void cpuRelax()
+{
+#if defined(__SSE2__)
+  _mm_pause();
+#endif
+}
+
+/*
+ * Chunks [head, tail) of current loop held by one thread. The owner takes
+ * chunks from head; other threads steal them from tail. Padded so deques
+ * of different threads are not on the same cache line.
+ */
+struct ChunkDeque
+{
+  std::mutex mtx;
+  Index_type head;
+  Index_type tail;
+  char pad[64];
+};
+
+static bool takeChunk(ChunkDeque& deque, bool steal, Index_type& ichunk)
+{
+  std::lock_guard<std::mutex> lock(deque.mtx);
+  if ( deque.head >= deque.tail ) {
+    return false;
+  }
+  ichunk = ( steal ? --deque.tail : deque.head++ );
+  return true;
+}
+
+
+class WorkStealingPool
+{
+public:
+  WorkStealingPool()
+    : nthreads(0), bound(false), spin_wait(true), stopping(false),
+      loop_func(nullptr), loop_body(nullptr),
+      loop_begin(0), loop_end(0), loop_chunk(1),
+      loop_count(0), busy_workers(0), started_workers(0), bind_failed(false),
+      total_chunks(0), stolen_chunks(0)
+  { }
+
+  ~WorkStealingPool() { stop(); }
+
+  int size() const { return nthreads; }
+
+  bool resize(int n, ThreadBindID bind);
+
+  void run(Index_type ibegin, Index_type iend,
+           ThreadPoolChunkFunc func, const void* body);
+
+  void getChunkCounts(double& chunks, double& stolen) const
+  {
+    chunks = static_cast<double>( total_chunks.load() );
+    stolen = static_cast<double>( stolen_chunks.load() );
+  }
+
+private:
+  void stop();
+  void workerMain(int tid, bool rebind, ThreadBindID bind,
+                  unsigned long first_loop);
+  void runChunks(int tid);
+
+  int nthreads;
+  bool bound;
+  bool spin_wait;
+  bool stopping;
+  std::vector<std::thread> workers;
+  std::unique_ptr<ChunkDeque[]> deques;
+
+  ThreadPoolChunkFunc loop_func;
+  const void* loop_body;
+  Index_type loop_begin;
+  Index_type loop_end;
+  Index_type loop_chunk;
+
+  std::mutex wake_mtx;
+  std::condition_variable wake_cv;
+  std::atomic<unsigned long> loop_count;
+  std::atomic<int> busy_workers;
+  std::atomic<int> started_workers;
+  std::atomic<bool> bind_failed;
+
+  std::atomic<long long> total_chunks;
+  std::atomic<long long> stolen_chunks;
+};
+
+void WorkStealingPool::stop()
+{
+  if ( workers.empty() ) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(wake_mtx);
+    stopping = true;
+    loop_count.fetch_add(1, std::memory_order_release);
+  }
+  wake_cv.notify_all();
+
+  for (size_t iw = 0; iw < workers.size(); ++iw) {
+    workers[iw].join();
+  }
+  workers.clear();
+  stopping = false;
+}
+
+bool WorkStealingPool::resize(int n, ThreadBindID bind)
+{
+  stop();
+
+  nthreads = std::max(n, 1);
+  deques.reset( new ChunkDeque[nthreads] );
+  spin_wait = ( nthreads <= getNumCpus() );
+
+  //
+  // New threads start with cpu affinity of calling thread, so they are
+  // bound again (to all cpus with NoBind) if threads were bound before.
+  //
+  const bool rebind = ( bind != NoBind || bound );
+  bool ok = true;
+  if ( rebind ) {
+    ok = bindCurrentThread(0, nthreads, bind);
+  }
+
+  started_workers = 0;
+  bind_failed = false;
+  const unsigned long first_loop = loop_count.load();
+  for (int tid = 1; tid < nthreads; ++tid) {
+    workers.push_back( std::thread(&WorkStealingPool::workerMain, this,
+                                   tid, rebind, bind, first_loop) );
+  }
+  while ( started_workers.load() < nthreads - 1 ) {
+    std::this_thread::yield();
+  }
+
+  bound = ( bind != NoBind );
+  return ( ok && !bind_failed.load() );
+}
+
+void WorkStealingPool::workerMain(int tid, bool rebind, ThreadBindID bind,
+                                  unsigned long first_loop)
+{
+  if ( rebind && !bindCurrentThread(tid, nthreads, bind) ) {
+    bind_failed = true;
+  }
+  started_workers.fetch_add(1);
+
+  unsigned long last_loop = first_loop;
+  for ( ; ; ) {
+
+    const int nspins = ( spin_wait ? idle_spins : 0 );
+    unsigned long this_loop = loop_count.load(std::memory_order_acquire);
+    for (int is = 0; is < nspins && this_loop == last_loop; ++is) {
+      cpuRelax();
+      this_loop = loop_count.load(std::memory_order_acquire);
+    }
+    if ( this_loop == last_loop ) {
+      std::unique_lock<std::mutex> lock(wake_mtx);
+      wake_cv.wait(lock, [&] {
+        return loop_count.load(std::memory_order_acquire) != last_loop;
+      });
+      this_loop = loop_count.load(std::memory_order_acquire);
+    }
+    last_loop = this_loop;
+
+    if ( stopping ) {
+      return;
+    }
+
+    runChunks(tid);
+    busy_workers.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+void WorkStealingPool::runChunks(int tid)
+{
+  long long nrun = 0;
+  long long nstolen = 0;
+  Index_type ichunk;
+
+  while ( takeChunk(deques[tid], false, ichunk) ) {
+    const Index_type ibegin = loop_begin + ichunk * loop_chunk;
+    loop_func(loop_body, ibegin, std::min(ibegin + loop_chunk, loop_end));
+    ++nrun;
+  }
+
+  //
+  // No chunks are added to deques during a loop, so thread is done when
+  // it finds all other deques empty.
+  //
+  bool found = true;
+  while ( found ) {
+    found = false;
+    for (int k = 1; k < nthreads && !found; ++k) {
+      if ( takeChunk(deques[(tid + k) % nthreads], true, ichunk) ) {
+        const Index_type ibegin = loop_begin + ichunk * loop_chunk;
+        loop_func(loop_body, ibegin, std::min(ibegin + loop_chunk, loop_end));
+        ++nrun;
+        ++nstolen;
+        found = true;
+      }
+    }
+  }
+
+  total_chunks.fetch_add(nrun, std::memory_order_relaxed);
+  stolen_chunks.fetch_add(nstolen, std::memory_order_relaxed);
+}
+
+void WorkStealingPool::run(Index_type ibegin, Index_type iend,
+                           ThreadPoolChunkFunc func, const void* body)
+{
+  const Index_type len = iend - ibegin;
+  if ( len <= 0 ) {
+    return;
+  }
+
+  const Index_type nt = nthreads;
+  const Index_type chunk =
+    std::max( (len + nt * chunks_per_thread - 1) / (nt * chunks_per_thread),
+              min_chunk_length );
+  const Index_type nchunks = (len + chunk - 1) / chunk;
+
+  if ( nthreads == 1 || nchunks == 1 ) {
+    func(body, ibegin, iend);
+    total_chunks.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  //
+  // Workers are idle here, so deques and loop are set without locks; they
+  // are published to workers with the release of the new loop count.
+  //
+  for (Index_type t = 0; t < nt; ++t) {
+    deques[t].head = nchunks * t / nt;
+    deques[t].tail = nchunks * (t + 1) / nt;
+  }
+  loop_func = func;
+  loop_body = body;
+  loop_begin = ibegin;
+  loop_end = iend;
+  loop_chunk = chunk;
+  busy_workers.store(nthreads - 1, std::memory_order_relaxed);
+
+  {
+    std::lock_guard<std::mutex> lock(wake_mtx);
+    loop_count.fetch_add(1, std::memory_order_release);
+  }
+  wake_cv.notify_all();
+
+  runChunks(0);
+
+  while ( busy_workers.load(std::memory_order_acquire) > 0 ) {
+    if ( spin_wait ) {
+      cpuRelax();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+
+static WorkStealingPool pool;
+
+static int getDefaultPoolSize()
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  return getNumThreads();
+#else
+  const int nhw = static_cast<int>( std::thread::hardware_concurrency() );
+  return ( nhw > 0 ? nhw : 1 );
+#endif
+}
+
+void runThreadPoolLoop(Index_type ibegin, Index_type iend,
+                       ThreadPoolChunkFunc func, const void* body)
+{
+  if ( pool.size() == 0 ) {
+    pool.resize(getDefaultPoolSize(), NoBind);
+  }
+  pool.run(ibegin, iend, func, body);
+}
+
+bool setThreadPoolSize(int nthreads, ThreadBindID bind)
+{
+  return pool.resize(nthreads, bind);
+}
+
+int getThreadPoolSize()
+{
+  return ( pool.size() > 0 ? pool.size() : getDefaultPoolSize() );
+}
+
+void getThreadPoolChunkCounts(double& chunks, double& stolen_chunks)
+{
+  pool.getChunkCounts(chunks, stolen_chunks);
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RUN_THREADPOOL
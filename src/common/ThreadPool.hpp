@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Work-stealing pool of std::threads owned by the suite, used by the
+/// Base_ThreadPool and Lambda_ThreadPool kernel variants to run loops in
+/// parallel without OpenMP (i.e., as a task runtime would).
+///
+/// A loop over [ibegin, iend) is split into chunks of consecutive
+/// iterations. Each thread of the pool (the calling thread is thread 0)
+/// starts with a contiguous share of the chunks in its own deque, as the
+/// OpenMP static schedule would assign them. A thread runs chunks from the
+/// front of its deque in order; when its deque is empty, it steals chunks
+/// from the back of the deques of other threads until no chunks are left.
+/// The call returns when all chunks have run.
+///
+/// Worker threads spin for a short time after a loop finishes, so loops
+/// that follow each other closely (e.g., kernel reps) do not wait for
+/// threads to wake up, and then sleep until the next loop.
+///
+
+#ifndef RAJAPerf_ThreadPool_HPP
+#define RAJAPerf_ThreadPool_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/ThreadUtils.hpp"
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Type of function that runs loop body (passed as pointer) over
+ *        iterations [ibegin, iend) of one chunk.
+ */
+typedef void (*ThreadPoolChunkFunc)(const void* body,
+                                    Index_type ibegin, Index_type iend);
+
+/*!
+ * \brief Run chunks of loop over [ibegin, iend) on threads of the pool and
+ *        return when all have run.
+ *
+ * Use threadPoolForallChunks() or threadPoolForall() below instead.
+ */
+void runThreadPoolLoop(Index_type ibegin, Index_type iend,
+                       ThreadPoolChunkFunc func, const void* body);
+
+/*!
+ * \brief Set number of threads in pool (including calling thread) and
+ *        bind them to cpus with given policy (see ThreadUtils.hpp).
+ *
+ * The pool has as many threads as OpenMP parallel regions use until this
+ * is called (or one per hardware thread if OpenMP variants are not built).
+ * Returns false if threads could not be bound.
+ */
+bool setThreadPoolSize(int nthreads, ThreadBindID bind = NoBind);
+
+/*!
+ * \brief Return number of threads in pool.
+ */
+int getThreadPoolSize();
+
+/*!
+ * \brief Return number of chunks run by the pool, and number of those that
+ *        were stolen from another thread's deque, since the suite started.
+ */
+void getThreadPoolChunkCounts(double& chunks, double& stolen_chunks);
+
+
+/*!
+ * \brief Run body(ib, ie) on the pool for chunks [ib, ie) that cover
+ *        iterations [ibegin, iend), e.g., with a raw loop over the chunk.
+ */
+template <typename BODY>
+inline void threadPoolForallChunks(Index_type ibegin, Index_type iend,
+                                   const BODY& body)
+{
+  struct Chunk {
+    static void run(const void* b, Index_type ib, Index_type ie)
+    {
+      (*static_cast<const BODY*>(b))(ib, ie);
+    }
+  };
+  runThreadPoolLoop(ibegin, iend, &Chunk::run, &body);
+}
+
+/*!
+ * \brief Run body(i) on the pool for each iteration i in [ibegin, iend)
+ *        (as RAJA::forall would).
+ */
+template <typename BODY>
+inline void threadPoolForall(Index_type ibegin, Index_type iend,
+                             const BODY& body)
+{
+  struct Chunk {
+    static void run(const void* b, Index_type ib, Index_type ie)
+    {
+      const BODY& loop_body = *static_cast<const BODY*>(b);
+      for (Index_type i = ib; i < ie; ++i) {
+        loop_body(i);
+      }
+    }
+  };
+  runThreadPoolLoop(ibegin, iend, &Chunk::run, &body);
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
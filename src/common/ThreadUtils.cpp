@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ThreadUtils.hpp"
+#include "ThreadPool.hpp"
+
+#include "RAJA/config.hpp"
+
+#include <thread>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each thread binding policy.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF BINDING IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string ThreadBindNames [] =
+{
+  std::string("none"),
+  std::string("close"),
+  std::string("spread"),
+
+  std::string("Unknown Binding")  // Keep this at the end and DO NOT remove....
+
+}; // END ThreadBindNames
+
+
+const std::string& getThreadBindName(ThreadBindID bid)
+{
+  return ThreadBindNames[bid];
+}
+
+
+#if defined(__linux__)
+
+/*
+ * CPUs process may run on, saved before any thread is bound.
+ */
+static std::vector<int> allowed_cpus;
+
+static void saveAllowedCpus()
+{
+  if ( allowed_cpus.empty() ) {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if ( sched_getaffinity(0, sizeof(mask), &mask) == 0 ) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if ( CPU_ISSET(cpu, &mask) ) {
+          allowed_cpus.push_back(cpu);
+        }
+      }
+    }
+  }
+}
+
+int getNumCpus()
+{
+  saveAllowedCpus();
+  if ( allowed_cpus.empty() ) {
+    const int nhw = static_cast<int>( std::thread::hardware_concurrency() );
+    return ( nhw > 0 ? nhw : 1 );
+  }
+  return static_cast<int>( allowed_cpus.size() );
+}
+
+bool bindCurrentThread(int tid, int nthreads, ThreadBindID bind)
+{
+  saveAllowedCpus();
+  if ( allowed_cpus.empty() ) {
+    return false;
+  }
+
+  const int ncpus = static_cast<int>(allowed_cpus.size());
+
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if ( bind == BindClose ) {
+    CPU_SET(allowed_cpus[tid % ncpus], &mask);
+  } else if ( bind == BindSpread ) {
+    CPU_SET(allowed_cpus[ (static_cast<long>(tid) * ncpus / nthreads) % ncpus ],
+            &mask);
+  } else {
+    for (int ic = 0; ic < ncpus; ++ic) {
+      CPU_SET(allowed_cpus[ic], &mask);
+    }
+  }
+  return ( sched_setaffinity(0, sizeof(mask), &mask) == 0 );
+}
+
+#else  // no way to bind threads on this system
+
+int getNumCpus()
+{
+  const int nhw = static_cast<int>( std::thread::hardware_concurrency() );
+  return ( nhw > 0 ? nhw : 1 );
+}
+
+bool bindCurrentThread(int tid, int nthreads, ThreadBindID bind)
+{
+  (void) tid;
+  (void) nthreads;
+  return ( bind == NoBind );
+}
+
+#endif
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+int getNumThreads()
+{
+  return omp_get_max_threads();
+}
+
+#if defined(__linux__)
+
+/*
+ * Whether OpenMP threads are currently bound.
+ */
+static bool threads_bound = false;
+
+static bool bindOpenMPThreads(ThreadBindID bind)
+{
+  if ( bind == NoBind && !threads_bound ) {
+    return true;
+  }
+
+  saveAllowedCpus();
+  bool ok = true;
+
+  #pragma omp parallel reduction(&&:ok)
+  {
+    ok = bindCurrentThread(omp_get_thread_num(), omp_get_num_threads(), bind);
+  }
+
+  threads_bound = ( bind != NoBind );
+  return ok;
+}
+
+#else
+
+static bool bindOpenMPThreads(ThreadBindID bind)
+{
+  return ( bind == NoBind );
+}
+
+#endif
+
+bool setNumThreads(int nthreads, ThreadBindID bind)
+{
+  omp_set_num_threads(nthreads);
+  bool ok = bindOpenMPThreads(bind);
+
+#if defined(RUN_THREADPOOL)
+  ok = setThreadPoolSize(nthreads, bind) && ok;
+#endif
+
+  return ok;
+}
+
+#else  // no OpenMP variants; kernels other than thread pool variants 
+       // run on one thread
+
+int getNumThreads()
+{
+#if defined(RUN_THREADPOOL)
+  return getThreadPoolSize();
+#else
+  return 1;
+#endif
+}
+
+bool setNumThreads(int nthreads, ThreadBindID bind)
+{
+#if defined(RUN_THREADPOOL)
+  return setThreadPoolSize(nthreads, bind);
+#else
+  (void) nthreads;
+  return ( bind == NoBind );
+#endif
+}
+
+#endif
+
+}  // closing brace for rajaperf namespace
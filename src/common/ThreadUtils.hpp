@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for setting the number of OpenMP threads used by OpenMP kernel
+/// variants (and threads in the pool used by thread pool variants) and 
+/// binding those threads to cpus.
+///
+/// Threads are bound by setting the cpu affinity of each thread in an
+/// OpenMP team (or pool) on Linux systems, so binding can be changed while
+/// the suite runs (OMP_PROC_BIND is only read when the OpenMP runtime
+/// starts). CPUs are taken in order from those the process may run on
+/// when threads are first bound:
+///
+///   close  -- thread i is bound to the i-th cpu (e.g., fill one socket
+///             before the next with the usual Linux cpu numbering)
+///   spread -- threads are bound to cpus evenly spaced over all cpus
+///             (e.g., split threads across sockets)
+///
+
+#ifndef RAJAPerf_ThreadUtils_HPP
+#define RAJAPerf_ThreadUtils_HPP
+
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each thread binding policy.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF BINDING NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum ThreadBindID {
+
+  NoBind = 0,
+  BindClose,
+  BindSpread,
+
+  NumThreadBinds // Keep this one last and DO NOT remove (!!)
+
+};
+
+/*!
+ * \brief Return name of thread binding policy (as given on command line).
+ */
+const std::string& getThreadBindName(ThreadBindID bid);
+
+/*!
+ * \brief Return number of threads OpenMP parallel regions will use
+ *        (1 if OpenMP variants are not built).
+ */
+int getNumThreads();
+
+/*!
+ * \brief Return number of cpus the process may run on (before any threads
+ *        were bound).
+ */
+int getNumCpus();
+
+/*!
+ * \brief Set number of threads for OpenMP parallel regions that follow
+ *        (and threads in pool used by thread pool variants) and bind the 
+ *        threads to cpus with given policy.
+ *
+ * With NoBind, threads that were bound before may run on any cpu again.
+ * Returns false if threads could not be bound.
+ */
+bool setNumThreads(int nthreads, ThreadBindID bind);
+
+/*!
+ * \brief Bind calling thread, as thread tid of nthreads, to cpus with given
+ *        policy (as setNumThreads() binds each OpenMP thread).
+ *
+ * Returns false if thread could not be bound.
+ */
+bool bindCurrentThread(int tid, int nthreads, ThreadBindID bind);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
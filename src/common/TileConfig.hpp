@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tile sizes and register blocks that tiled variants (RAJA_Seq_Tiled and
+/// RAJA_OpenMP_Tiled) of the polybench matrix kernels are compiled for, 
+/// and the one a variant runs with (see TileUtils.hpp).
+///
+
+#ifndef RAJAPerf_TileConfig_HPP
+#define RAJAPerf_TileConfig_HPP
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RPTypes.hpp"
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Tile sizes and register blocks tiled variants are compiled for.
+ */
+const Index_type tile_sizes[] = { 16, 32, 64, 128 };
+const int num_tile_sizes = 4;
+///
+const Index_type register_blocks[] = { 1, 2, 4 };
+const int num_register_blocks = 3;
+
+/*!
+ * \brief Tile size and register block used when they are not given on
+ *        the command line or tuned.
+ */
+const Index_type default_tile_size = 32;
+const Index_type default_register_block = 4;
+
+/*!
+ * \brief Tile size and register block of a tiled kernel variant.
+ */
+struct TileConfig
+{
+  Index_type tile_size;
+  Index_type register_block;
+};
+
+inline bool isTileSize(Index_type ts)
+{
+  for (int i = 0; i < num_tile_sizes; ++i) {
+    if ( tile_sizes[i] == ts ) return true;
+  }
+  return false;
+}
+
+inline bool isRegisterBlock(Index_type rb)
+{
+  for (int i = 0; i < num_register_blocks; ++i) {
+    if ( register_blocks[i] == rb ) return true;
+  }
+  return false;
+}
+
+/*!
+ * \brief Return true if variant is one of the tiled variants.
+ */
+inline bool isTiledVariant(VariantID vid)
+{
+#if defined(RUN_TILED)
+  if ( vid == RAJA_Seq_Tiled ) return true;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == RAJA_OpenMP_Tiled ) return true;
+#endif
+#endif
+  (void) vid;
+  return false;
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,242 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods used by the RAJA_Seq_Tiled and RAJA_OpenMP_Tiled variants of
+/// the polybench matrix kernels.
+///
+/// Tiled variants loop over square tiles of tile_size rows and columns
+/// with RAJA::statement::Tile, and the innermost loop of each tile updates
+/// register_block rows of a matrix (or entries of a vector) at a time, so
+/// each value loaded from the other operand is used that many times.
+///
+/// RAJA tile sizes are template arguments (tile_fixed<S>), so tiled
+/// variants are compiled for each tile size and register block given in
+/// TileConfig.hpp, and dispatchTiledVariant() runs the one chosen at run
+/// time. Only the Foo-Tiled.cpp files that implement tiled variants
+/// include this header.
+///
+
+#ifndef RAJAPerf_TileUtils_HPP
+#define RAJAPerf_TileUtils_HPP
+
+#include "common/TileConfig.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <type_traits>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Run body(r, i) for rows i of register block ib (i.e., rows
+ *        ib*RB + r, r = 0, ..., RB-1, that are less than n).
+ *
+ * Full blocks loop over a fixed number of rows, so compilers can unroll
+ * the loop and keep values shared by the rows in registers.
+ */
+template <Index_type RB, typename BODY>
+RAJA_INLINE void forRegisterBlock(Index_type ib, Index_type n, 
+                                  const BODY& body)
+{
+  const Index_type ibegin = ib * RB;
+  if ( ibegin + RB <= n ) {
+    for (Index_type r = 0; r < RB; ++r) {
+      body(r, ibegin + r);
+    }
+  } else {
+    for (Index_type r = 0; ibegin + r < n; ++r) {
+      body(r, ibegin + r);
+    }
+  }
+}
+
+/*!
+ * \brief Partial sums kept by a tiled loop (e.g., one for each row of a
+ *        register block), passed to kernel lambdas as a RAJA kernel param.
+ */
+template <Index_type N>
+struct TileAccum
+{
+  Accum_type v[N];
+};
+
+/*!
+ * \brief RAJA kernel policy for tiled matrix product C = A*B with segments
+ *        (ib, j, k), where ib is register block of rows of C, and kernel
+ *        param TileAccum<RB*TILE> holding a dot product for each row of
+ *        block and each j of a tile.
+ *
+ * For each block ib and tile of j, Lambda<0>(ib, j, k, acc) initializes
+ * the dot products, Lambda<1> adds A(i, k)*B(k, j) for rows i of block ib,
+ * for k in order, with j innermost so rows of B are read with unit stride,
+ * and Lambda<2> stores the dot products in C. Dot product of row r of
+ * block and j is entry r*TILE + j % TILE of kernel param, so sums are
+ * kept in Accum_type until they are stored, as in untiled variants.
+ */
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+using TiledMatMulPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE/RB>, OUTER_POL,
+      RAJA::statement::Tile<1, RAJA::statement::tile_fixed<TILE>,
+                               RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::Lambda<0>
+          >,
+          RAJA::statement::For<2, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<1>
+            >
+          >,
+          RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::Lambda<2>
+          >
+        >
+      >
+    >
+  >;
+
+/*!
+ * \brief RAJA kernel policy for tiled matrix-vector product with segments
+ *        (ib, j), where ib is register block of matrix rows, and kernel
+ *        param TileAccum<RB> holding a dot product for each row of block.
+ *
+ * For each ib, Lambda<0> initializes the dot products, Lambda<1> adds the
+ * terms for column j (each vector value loaded once for RB rows), for j
+ * in order, and Lambda<2> stores the dot products.
+ */
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+using TiledRowDotPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE/RB>, OUTER_POL,
+      RAJA::statement::For<0, RAJA::loop_exec,
+        RAJA::statement::Lambda<0>,
+        RAJA::statement::For<1, RAJA::loop_exec,
+          RAJA::statement::Lambda<1>
+        >,
+        RAJA::statement::Lambda<2>
+      >
+    >
+  >;
+
+/*!
+ * \brief RAJA kernel policy for tiled transposed matrix-vector product
+ *        (dot products of matrix columns i) with segments (i, jb), where
+ *        jb is register block of matrix rows, and kernel param
+ *        TileAccum<TILE> holding a dot product for each i of a tile.
+ *
+ * For each tile of i, Lambda<0> initializes the dot products, Lambda<1>
+ * adds the terms for rows j of block jb (jb in order), with i innermost
+ * so matrix rows are read with unit stride, and Lambda<2> stores the
+ * dot products. Dot product of i is entry i % TILE of kernel param.
+ */
+template <Index_type TILE, typename OUTER_POL>
+using TiledColumnDotPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE>, OUTER_POL,
+      RAJA::statement::Lambda<0>,
+      RAJA::statement::For<1, RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::Lambda<1>
+        >
+      >,
+      RAJA::statement::For<0, RAJA::loop_exec,
+        RAJA::statement::Lambda<2>
+      >
+    >
+  >;
+
+/*!
+ * \brief Call kernel.runTiledVariantImpl<TILE, RB, OUTER_POL>() for tile
+ *        size and register block in config, where OUTER_POL is policy of
+ *        outermost tile loop of variant (sequential or OpenMP).
+ *
+ * Kernels that don't use register blocks call dispatchTiledVariant<false>(),
+ * so they are compiled only for RB = 1 and it is run for any register block.
+ */
+template <typename OUTER_POL, Index_type TILE, typename KERNEL>
+inline void dispatchTiledVariantRB(KERNEL& kernel, Index_type, 
+                                   std::false_type)
+{
+  kernel.template runTiledVariantImpl<TILE, 1, OUTER_POL>();
+}
+///
+template <typename OUTER_POL, Index_type TILE, typename KERNEL>
+inline void dispatchTiledVariantRB(KERNEL& kernel, Index_type rb,
+                                   std::true_type)
+{
+  switch ( rb ) {
+    case 1 : 
+      kernel.template runTiledVariantImpl<TILE, 1, OUTER_POL>(); break;
+    case 2 : 
+      kernel.template runTiledVariantImpl<TILE, 2, OUTER_POL>(); break;
+    default : 
+      kernel.template runTiledVariantImpl<TILE, 4, OUTER_POL>(); break;
+  }
+}
+///
+template <bool USE_RB, typename OUTER_POL, typename KERNEL>
+inline void dispatchTiledVariantTile(KERNEL& kernel, const TileConfig& config)
+{
+  using use_rb = std::integral_constant<bool, USE_RB>;
+
+  switch ( config.tile_size ) {
+    case 16 :
+      dispatchTiledVariantRB<OUTER_POL, 16>(kernel, config.register_block,
+                                            use_rb());
+      break;
+    case 64 :
+      dispatchTiledVariantRB<OUTER_POL, 64>(kernel, config.register_block,
+                                            use_rb());
+      break;
+    case 128 :
+      dispatchTiledVariantRB<OUTER_POL, 128>(kernel, config.register_block,
+                                            use_rb());
+      break;
+    default :
+      dispatchTiledVariantRB<OUTER_POL, 32>(kernel, config.register_block,
+                                            use_rb());
+      break;
+  }
+}
+///
+template <bool USE_RB = true, typename KERNEL>
+inline void dispatchTiledVariant(KERNEL& kernel, VariantID vid)
+{
+  switch ( vid ) {
+
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled : {
+      dispatchTiledVariantTile<USE_RB, RAJA::loop_exec>(kernel, 
+                                                kernel.getTileConfig(vid));
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled : {
+      dispatchTiledVariantTile<USE_RB, RAJA::omp_parallel_for_exec>(kernel, 
+                                                kernel.getTileConfig(vid));
+      break;
+    }
+#endif
+#endif
+
+    default : {
+      std::cout << "\n  " << kernel.getName() 
+                << " : Unknown tiled variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
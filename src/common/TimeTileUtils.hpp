@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods used by the Base_Seq_TimeTiled and Base_OpenMP_TimeTiled
+/// variants of the polybench stencil kernels, which run several time steps
+/// on each tile of rows (outermost index of the grid) while it is in cache.
+///
+/// Tiles are split tiles: time steps are run in blocks, and for each block
+///
+///   phase 1 -- each tile of rows [L, R) runs every stage (e.g., each
+///              of the two sweeps of a Jacobi time step) of every time
+///              step of the block on rows that shrink from both sides
+///              by the rows that stage depends on (a trapezoid);
+///   phase 2 -- rows left out near each boundary X between tiles are
+///              run, stage by stage, on rows that grow around X (an
+///              inverted trapezoid).
+///
+/// Tiles of each phase only write their own rows, and rows read from
+/// neighbors are not written in the same phase, so tiles of a phase can
+/// run in parallel. Each value is computed from the same values as in the
+/// Base_Seq variant, and is not overwritten before the last stage that
+/// reads it runs, so checksums are the same.
+///
+/// The rows a stage depends on are given by a shrink functor:
+///
+///   shrink(t, s, left, right)
+///
+/// sets rows removed from the left and right sides of phase 1 tiles at
+/// stage s of time step t of a block (t = 0 is first step of block); in
+/// phase 2, stage s of step t runs rows [X - right, X + left). Rows at
+/// the ends of the grid do not shrink since boundary values are fixed.
+///
+
+#ifndef RAJAPerf_TimeTileUtils_HPP
+#define RAJAPerf_TimeTileUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Bytes of kernel data in rows of each tile (if a tile of that size
+ *        has enough rows for a block of time steps); about half of a
+ *        typical per-core L2 cache.
+ */
+const Index_type time_tile_bytes = 512 * 1024;
+
+/*!
+ * \brief Shrink functor for stencils whose stages each read rows i-1, i,
+ *        and i+1 of the values written by the stage before.
+ */
+template <Index_type NSTAGES>
+struct SymmetricShrink
+{
+  void operator()(Index_type t, Index_type s,
+                  Index_type& left, Index_type& right) const
+  {
+    left = t*NSTAGES + s;
+    right = left;
+  }
+};
+
+/*!
+ * \brief Return rows in each tile of row range of length n for rows of
+ *        row_bytes bytes each. If nthreads > 1, tiles are made small 
+ *        enough that there are at least as many tiles as threads.
+ *
+ * forTimeTiles() widens tiles that are too narrow for a time block.
+ */
+inline Index_type getTimeTileRows(Index_type n, Index_type row_bytes,
+                                  int nthreads)
+{
+  Index_type rows = time_tile_bytes / std::max(row_bytes, Index_type(1));
+  if ( nthreads > 1 ) {
+    rows = std::min(rows, n / nthreads);
+  }
+  return std::max(rows, Index_type(1));
+}
+
+/*!
+ * \brief Run body(t, s, lo, hi) for stages s = 0, ..., nstages-1 of time
+ *        steps t = 0, ..., tsteps-1 on rows [lo, hi) of [ibegin, iend),
+ *        in split tiles of about tile_rows rows and blocks of block_steps
+ *        time steps.
+ *
+ * Tiles of each phase are run in parallel with OpenMP when PARALLEL is
+ * true. Tiles are widened when needed so phase 2 rows of neighboring
+ * boundaries do not overlap.
+ */
+template <bool PARALLEL, typename SHRINK, typename BODY>
+inline void forTimeTiles(Index_type tsteps, Index_type nstages,
+                         Index_type block_steps,
+                         Index_type ibegin, Index_type iend,
+                         Index_type tile_rows,
+                         const SHRINK& shrink, const BODY& body)
+{
+  Index_type max_left = 0;
+  Index_type max_right = 0;
+  shrink(block_steps-1, nstages-1, max_left, max_right);
+
+  const Index_type n = iend - ibegin;
+  const Index_type width =
+    std::max(tile_rows, max_left + max_right + 2);
+  const Index_type ntiles = std::max(n / width, Index_type(1));
+
+  for (Index_type tb = 0; tb < tsteps; tb += block_steps) {
+
+    const Index_type nt = std::min(block_steps, tsteps - tb);
+
+    auto phase1 = [&](Index_type it) {
+      const Index_type L = ibegin + it*width;
+      const Index_type R = ( it == ntiles-1 ? iend : L + width );
+      for (Index_type t = 0; t < nt; ++t) {
+        for (Index_type s = 0; s < nstages; ++s) {
+          Index_type left, right;
+          shrink(t, s, left, right);
+          const Index_type lo = ( it == 0 ? L : L + left );
+          const Index_type hi = ( it == ntiles-1 ? R : R - right );
+          if ( lo < hi ) body(tb + t, s, lo, hi);
+        }
+      }
+    };
+
+    auto phase2 = [&](Index_type it) {
+      const Index_type X = ibegin + it*width;
+      for (Index_type t = 0; t < nt; ++t) {
+        for (Index_type s = 0; s < nstages; ++s) {
+          Index_type left, right;
+          shrink(t, s, left, right);
+          const Index_type lo = X - right;
+          const Index_type hi = X + left;
+          if ( lo < hi ) body(tb + t, s, lo, hi);
+        }
+      }
+    };
+
+    if ( PARALLEL ) {
+#if defined(_OPENMP)
+      #pragma omp parallel for schedule(static, 1)
+#endif
+      for (Index_type it = 0; it < ntiles; ++it) {
+        phase1(it);
+      }
+#if defined(_OPENMP)
+      #pragma omp parallel for schedule(static, 1)
+#endif
+      for (Index_type it = 1; it < ntiles; ++it) {
+        phase2(it);
+      }
+    } else {
+      for (Index_type it = 0; it < ntiles; ++it) {
+        phase1(it);
+      }
+      for (Index_type it = 1; it < ntiles; ++it) {
+        phase2(it);
+      }
+    }
+
+  }
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
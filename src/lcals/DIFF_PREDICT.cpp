@@ -31,12 +31,26 @@ DIFF_PREDICT::DIFF_PREDICT(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(2000);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 DIFF_PREDICT::~DIFF_PREDICT() 
 {
 }
 
+Index_type DIFF_PREDICT::getBytesPerRep() const
+{
+  return (10*sizeof(Real_type) + 10*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type DIFF_PREDICT::getFLOPsPerRep() const
+{
+  return 9 * getRunSize();
+}
+
 void DIFF_PREDICT::setUp(VariantID vid)
 {
   m_array_length = getRunSize() * 14;
@@ -129,6 +143,14 @@ void DIFF_PREDICT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
 
 #include <iostream>
 
@@ -30,18 +31,42 @@ namespace lcals
   const Real_type r = m_r; \
   const Real_type t = m_t;
 
+#define EOS_DATA_SETUP_SIMD \
+  const SIMDReal vq = simdSet1(q); \
+  const SIMDReal vr = simdSet1(r); \
+  const SIMDReal vt = simdSet1(t);
+
 
 EOS::EOS(const RunParams& params)
   : KernelBase(rajaperf::Lcals_EOS, params)
 {
    setDefaultSize(100000);
    setDefaultReps(5000);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 EOS::~EOS() 
 {
 }
 
+Index_type EOS::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize() +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * (getRunSize() + 6);
+}
+
+Index_type EOS::getFLOPsPerRep() const
+{
+  return 16 * getRunSize();
+}
+
 void EOS::setUp(VariantID vid)
 {
   m_array_length = getRunSize() + 7;
@@ -101,6 +126,48 @@ void EOS::runKernel(VariantID vid)
     }
 #endif // RUN_RAJA_SEQ
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      EOS_DATA_SETUP_CPU;
+      EOS_DATA_SETUP_SIMD;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          EOS_BODY_SIMD;
+        }
+        for ( ; i < iend; ++i ) {
+          EOS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      EOS_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          EOS_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
     case Base_OpenMP : {
 
@@ -139,6 +206,14 @@ void EOS::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -26,6 +26,13 @@
                    t*( u[i+6] + q*( u[i+5] + q*u[i+4] ) ) );
 
 
+#define EOS_BODY_SIMD  \
+  simdStore( &x[i], \
+    simdLoad(&u[i]) + vr*( simdLoad(&z[i]) + vr*simdLoad(&y[i]) ) + \
+    vt*( simdLoad(&u[i+3]) + vr*( simdLoad(&u[i+2]) + vr*simdLoad(&u[i+1]) ) + \
+         vt*( simdLoad(&u[i+6]) + vq*( simdLoad(&u[i+5]) + vq*simdLoad(&u[i+4]) ) ) ) );
+
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf 
@@ -43,6 +50,9 @@ public:
 
   ~EOS();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -50,6 +60,7 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_ptr m_x;
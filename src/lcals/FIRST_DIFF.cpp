@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
 
 #include <iostream>
 
@@ -30,12 +31,31 @@ FIRST_DIFF::FIRST_DIFF(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(16000);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 FIRST_DIFF::~FIRST_DIFF() 
 {
 }
 
+Index_type FIRST_DIFF::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getRunSize() +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * (getRunSize() + 1);
+}
+
+Index_type FIRST_DIFF::getFLOPsPerRep() const
+{
+  return 1 * getRunSize();
+}
+
 void FIRST_DIFF::setUp(VariantID vid)
 {
   m_array_length = getRunSize()+1; 
@@ -88,6 +108,47 @@ void FIRST_DIFF::runKernel(VariantID vid)
     }
 #endif // RUN_RAJA_SEQ
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      FIRST_DIFF_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          FIRST_DIFF_BODY_SIMD;
+        }
+        for ( ; i < iend; ++i ) {
+          FIRST_DIFF_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      FIRST_DIFF_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIRST_DIFF_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
     case Base_OpenMP : {
 
@@ -126,6 +187,14 @@ void FIRST_DIFF::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
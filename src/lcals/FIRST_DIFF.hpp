@@ -22,6 +22,10 @@
   x[i] = y[i+1] - y[i];
 
 
+#define FIRST_DIFF_BODY_SIMD  \
+  simdStore( &x[i], simdLoad(&y[i+1]) - simdLoad(&y[i]) );
+
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf 
@@ -39,6 +43,9 @@ public:
 
   ~FIRST_DIFF();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -46,6 +53,7 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_ptr m_x;
@@ -35,12 +35,27 @@ HYDRO_1D::HYDRO_1D(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(12500);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 HYDRO_1D::~HYDRO_1D() 
 {
 }
 
+Index_type HYDRO_1D::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getRunSize() +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * (getRunSize() + 1);
+}
+
+Index_type HYDRO_1D::getFLOPsPerRep() const
+{
+  return 5 * getRunSize();
+}
+
 void HYDRO_1D::setUp(VariantID vid)
 {
   m_array_length = getRunSize() + 12;
@@ -138,6 +153,14 @@ void HYDRO_1D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
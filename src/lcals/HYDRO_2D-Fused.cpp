@@ -0,0 +1,246 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_FUSED)
+
+#include "common/ThreadUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace lcals
+{
+
+#define HYDRO_2D_DATA_SETUP_FUSED \
+  ResReal_ptr za = m_za; \
+  ResReal_ptr zb = m_zb; \
+  ResReal_ptr zm = m_zm; \
+  ResReal_ptr zp = m_zp; \
+  ResReal_ptr zq = m_zq; \
+  ResReal_ptr zr = m_zr; \
+  ResReal_ptr zu = m_zu; \
+  ResReal_ptr zv = m_zv; \
+  ResReal_ptr zz = m_zz; \
+\
+  ResReal_ptr zrout = m_zrout; \
+  ResReal_ptr zzout = m_zzout; \
+\
+  const Real_type s = m_s; \
+  const Real_type t = m_t; \
+\
+  const Index_type jn = m_jn;
+
+
+//
+// The third loop reads only zu and zv at the point the second loop writes,
+// so they fuse point by point. The second loop reads za and zb at rows k 
+// and k+1, which the first loop writes, so the fused loop over rows runs
+// the first loop body on row k+1 and then the other two on row k. Arrays
+// za and zb are then read while still in cache, and each point of the 
+// other arrays is moved once.
+//
+// In parallel variants, each thread runs the fused loop on a chunk of rows
+// [k0, k1); the second and third loop bodies on row k1-1, which read za
+// and zb of the first row of the next chunk, run after all chunks finish.
+//
+Index_type HYDRO_2D::getFusedBytesPerRep() const
+{
+  return (0*sizeof(Real_type) + 7*sizeof(Real_type)) * m_jn * getRunSize() +
+         (6*sizeof(Real_type) + 0*sizeof(Real_type)) * (m_jn-2) * (getRunSize()-2);
+}
+
+void HYDRO_2D::runFusedVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_DATA_SETUP_FUSED;
+
+  auto body1_row = [=](Index_type k) {
+    for (Index_type j = jbeg; j < jend; ++j ) {
+      HYDRO_2D_BODY1;
+    }
+  };
+  auto body23_row = [=](Index_type k) {
+    for (Index_type j = jbeg; j < jend; ++j ) {
+      HYDRO_2D_BODY2;
+      HYDRO_2D_BODY3;
+    }
+  };
+
+  auto hydro_2d_fused_lam1 = [=](Index_type k, Index_type j) {
+                               HYDRO_2D_BODY1;
+                             };
+  auto hydro_2d_fused_lam23 = [=](Index_type k, Index_type j) {
+                                HYDRO_2D_BODY2;
+                                HYDRO_2D_BODY3;
+                              };
+
+  using ROWS_EXECPOL =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::loop_exec,    // k
+        RAJA::statement::For<1, RAJA::loop_exec,  // j
+          RAJA::statement::Lambda<0>
+        >,
+        RAJA::statement::For<1, RAJA::loop_exec,  // j
+          RAJA::statement::Lambda<1>
+        >
+      >
+    >;
+
+  //
+  // RAJA variants run rows [k0, k1) of a chunk as a kernel over rows 
+  // [k0-1, k1-1) that runs the first loop body on row k+1 and, except on 
+  // row k0-1, the other two on row k.
+  //
+  auto raja_chunk = [=](Index_type k0, Index_type k1) {
+    RAJA::kernel<ROWS_EXECPOL>(
+      RAJA::make_tuple( RAJA::RangeSegment(k0-1, k1-1),
+                        RAJA::RangeSegment(jbeg, jend) ),
+      [=] (Index_type k, Index_type j) {
+        hydro_2d_fused_lam1(k+1, j);
+      },
+      [=] (Index_type k, Index_type j) {
+        if ( k >= k0 ) {
+          hydro_2d_fused_lam23(k, j);
+        }
+      }
+    );
+  };
+
+  auto raja_row23 = [=](Index_type k) {
+    RAJA::forall<RAJA::loop_exec>(
+      RAJA::RangeSegment(jbeg, jend), [=](Index_type j) {
+      hydro_2d_fused_lam23(k, j);
+    });
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        body1_row(kbeg);
+        for (Index_type k = kbeg; k < kend-1; ++k ) {
+          body1_row(k+1);
+          body23_row(k);
+        }
+        body23_row(kend-1);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        raja_chunk(kbeg, kend);
+        raja_row23(kend-1);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused : {
+
+      const Index_type nchunks = 
+        std::max(std::min(Index_type(getNumThreads()), kend-kbeg), 
+                 Index_type(1));
+      auto chunk_begin = [=](Index_type ic) {
+        return kbeg + ic*(kend-kbeg)/nchunks;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static, 1)
+          for (Index_type ic = 0; ic < nchunks; ++ic) {
+            const Index_type k0 = chunk_begin(ic);
+            const Index_type k1 = chunk_begin(ic+1);
+            body1_row(k0);
+            for (Index_type k = k0; k < k1-1; ++k ) {
+              body1_row(k+1);
+              body23_row(k);
+            }
+          }
+
+          #pragma omp for schedule(static, 1) nowait
+          for (Index_type ic = 0; ic < nchunks; ++ic) {
+            body23_row(chunk_begin(ic+1)-1);
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      const Index_type nchunks = 
+        std::max(std::min(Index_type(getNumThreads()), kend-kbeg), 
+                 Index_type(1));
+      auto chunk_begin = [=](Index_type ic) {
+        return kbeg + ic*(kend-kbeg)/nchunks;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type ic) {
+          raja_chunk(chunk_begin(ic), chunk_begin(ic+1));
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type ic) {
+          raja_row23(chunk_begin(ic+1)-1);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  HYDRO_2D : Unknown fused variant id = " << vid 
+                << std::endl;
+    }
+
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RUN_FUSED
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_STDPAR)
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace lcals
+{
+
+#define HYDRO_2D_DATA_SETUP_STDPAR \
+  ResReal_ptr za = m_za; \
+  ResReal_ptr zb = m_zb; \
+  ResReal_ptr zm = m_zm; \
+  ResReal_ptr zp = m_zp; \
+  ResReal_ptr zq = m_zq; \
+  ResReal_ptr zr = m_zr; \
+  ResReal_ptr zu = m_zu; \
+  ResReal_ptr zv = m_zv; \
+  ResReal_ptr zz = m_zz; \
+\
+  ResReal_ptr zrout = m_zrout; \
+  ResReal_ptr zzout = m_zzout; \
+\
+  const Real_type s = m_s; \
+  const Real_type t = m_t; \
+\
+  const Index_type jn = m_jn;
+
+
+void HYDRO_2D::runStdParVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  if ( vid == Base_StdPar ) {
+
+    HYDRO_2D_DATA_SETUP_STDPAR;
+
+    const IndexIterator kbegin_it(kbeg);
+    const IndexIterator kend_it(kend);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      std::for_each( std::execution::par_unseq, kbegin_it, kend_it,
+        [=](Index_type k) {
+        for (Index_type j = jbeg; j < jend; ++j ) {
+          HYDRO_2D_BODY1;
+        }
+      });
+
+      std::for_each( std::execution::par_unseq, kbegin_it, kend_it,
+        [=](Index_type k) {
+        for (Index_type j = jbeg; j < jend; ++j ) {
+          HYDRO_2D_BODY2;
+        }
+      });
+
+      std::for_each( std::execution::par_unseq, kbegin_it, kend_it,
+        [=](Index_type k) {
+        for (Index_type j = jbeg; j < jend; ++j ) {
+          HYDRO_2D_BODY3;
+        }
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     std::cout << "\n  HYDRO_2D : Unknown StdPar variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RUN_STDPAR
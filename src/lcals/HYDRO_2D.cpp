@@ -61,6 +61,26 @@ namespace lcals
   const Index_type jn = m_jn;
 
 
+#define HYDRO_2D_DATA_SETUP_LAYOUT \
+  FIELD_PTR za(m_zonal, 11, 0); \
+  FIELD_PTR zb(m_zonal, 11, 1); \
+  FIELD_PTR zm(m_zonal, 11, 2); \
+  FIELD_PTR zp(m_zonal, 11, 3); \
+  FIELD_PTR zq(m_zonal, 11, 4); \
+  FIELD_PTR zr(m_zonal, 11, 5); \
+  FIELD_PTR zu(m_zonal, 11, 6); \
+  FIELD_PTR zv(m_zonal, 11, 7); \
+  FIELD_PTR zz(m_zonal, 11, 8); \
+\
+  FIELD_PTR zrout(m_zonal, 11, 9); \
+  FIELD_PTR zzout(m_zonal, 11, 10); \
+\
+  const Real_type s = m_s; \
+  const Real_type t = m_t; \
+\
+  const Index_type jn = m_jn;
+
+
 HYDRO_2D::HYDRO_2D(const RunParams& params)
   : KernelBase(rajaperf::Lcals_HYDRO_2D, params)
 {
@@ -72,12 +92,39 @@ HYDRO_2D::HYDRO_2D(const RunParams& params)
 
    setDefaultSize(m_jn);
    setDefaultReps(200);
+
+   m_zonal = 0;
+   setDataLayoutsDefined();
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+
+#if defined(RUN_FUSED)
+   setVariantDefined(Base_Seq_Fused);
+   setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+   setVariantDefined(Base_OpenMP_Fused);
+   setVariantDefined(RAJA_OpenMP_Fused);
+#endif
+#endif
 }
 
 HYDRO_2D::~HYDRO_2D() 
 {
 }
 
+Index_type HYDRO_2D::getBytesPerRep() const
+{
+  return (0*sizeof(Real_type) + 12*sizeof(Real_type)) * m_jn * getRunSize() +
+         (6*sizeof(Real_type) + 2*sizeof(Real_type)) * (m_jn-2) * (getRunSize()-2);
+}
+
+Index_type HYDRO_2D::getFLOPsPerRep() const
+{
+  return (14 + 26 + 4) * (m_jn-2) * (getRunSize()-2);
+}
+
 void HYDRO_2D::setUp(VariantID vid)
 {
   m_kn = getRunSize();
@@ -94,6 +141,195 @@ void HYDRO_2D::setUp(VariantID vid)
   allocAndInitData(m_zu, m_array_length, vid);
   allocAndInitData(m_zv, m_array_length, vid);
   allocAndInitData(m_zz, m_array_length, vid);
+
+  if ( getDataLayout(vid) != SoA ) {
+    const Real_ptr fields[] = { m_za, m_zb, m_zm, m_zp, m_zq, m_zr, 
+                                m_zu, m_zv, m_zz, m_zrout, m_zzout };
+    allocAndPackData(m_zonal, fields, 11, m_array_length, 
+                     getDataLayout(vid), vid);
+  }
+}
+
+//
+// Sequential and OpenMP variants with all arrays in AoS or AoSoA layout 
+// (FIELD_PTR is LayoutReal_ptr for the layout). RAJA variants use the 
+// pointer loop bodies, since RAJA Views index a single array.
+//
+template <typename FIELD_PTR>
+void HYDRO_2D::runDataLayoutVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_DATA_SETUP_LAYOUT;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY1;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY2;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY3;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)     
+    case RAJA_Seq : {
+
+      using EXECPOL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,  // k
+            RAJA::statement::For<1, RAJA::loop_exec,  // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXECPOL>( 
+          RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                            RAJA::RangeSegment(jbeg, jend)), 
+          [=] (Index_type k, Index_type j) {
+          HYDRO_2D_BODY1;
+        });
+
+        RAJA::kernel<EXECPOL>( 
+          RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                            RAJA::RangeSegment(jbeg, jend)), 
+          [=] (Index_type k, Index_type j) {
+          HYDRO_2D_BODY2;
+        });
+
+        RAJA::kernel<EXECPOL>( 
+          RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                            RAJA::RangeSegment(jbeg, jend)), 
+          [=] (Index_type k, Index_type j) {
+          HYDRO_2D_BODY3;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for nowait
+          for (Index_type k = kbeg; k < kend; ++k ) {
+            for (Index_type j = jbeg; j < jend; ++j ) {
+              HYDRO_2D_BODY1;
+            }
+          }
+
+          #pragma omp for nowait
+          for (Index_type k = kbeg; k < kend; ++k ) {
+            for (Index_type j = jbeg; j < jend; ++j ) {
+              HYDRO_2D_BODY2;
+            }
+          }
+
+          #pragma omp for nowait
+          for (Index_type k = kbeg; k < kend; ++k ) {
+            for (Index_type j = jbeg; j < jend; ++j ) {
+              HYDRO_2D_BODY3;
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXECPOL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_for_nowait_exec,  // k
+            RAJA::statement::For<1, RAJA::loop_exec,  // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          RAJA::kernel<EXECPOL>(
+            RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                              RAJA::RangeSegment(jbeg, jend)),
+            [=] (Index_type k, Index_type j) {
+            HYDRO_2D_BODY1;
+          });
+
+          RAJA::kernel<EXECPOL>(
+            RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                              RAJA::RangeSegment(jbeg, jend)),
+            [=] (Index_type k, Index_type j) {
+            HYDRO_2D_BODY2;
+          });
+
+          RAJA::kernel<EXECPOL>(
+            RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                              RAJA::RangeSegment(jbeg, jend)),
+            [=] (Index_type k, Index_type j) {
+            HYDRO_2D_BODY3;
+          });
+
+        }); // end omp parallel region 
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  HYDRO_2D : Unknown data layout variant id = " << vid 
+                << std::endl;
+    }
+
+  }
 }
 
 void HYDRO_2D::runKernel(VariantID vid)
@@ -104,6 +340,20 @@ void HYDRO_2D::runKernel(VariantID vid)
   const Index_type jbeg = 1;
   const Index_type jend = m_jn - 1;
 
+  switch ( getDataLayout(vid) ) {
+    case AoS : {
+      runDataLayoutVariant< LayoutReal_ptr<AoS> >(vid);
+      return;
+    }
+    case AoSoA : {
+      runDataLayoutVariant< LayoutReal_ptr<AoSoA> >(vid);
+      return;
+    }
+    default : {
+      break;
+    }
+  }
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -274,6 +524,27 @@ void HYDRO_2D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
+#if defined(RUN_FUSED)
+    case Base_Seq_Fused :
+    case RAJA_Seq_Fused :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused :
+    case RAJA_OpenMP_Fused :
+#endif
+    {
+      runFusedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -302,6 +573,11 @@ void HYDRO_2D::runKernel(VariantID vid)
 
 void HYDRO_2D::updateChecksum(VariantID vid)
 {
+  if ( getDataLayout(vid) != SoA ) {
+    unpackData(m_zrout, m_zonal, 11, 9, m_array_length, getDataLayout(vid));
+    unpackData(m_zzout, m_zonal, 11, 10, m_array_length, getDataLayout(vid));
+  }
+
   checksum[vid] += calcChecksum(m_zzout, m_array_length);
   checksum[vid] += calcChecksum(m_zrout, m_array_length);
 }
@@ -320,6 +596,7 @@ void HYDRO_2D::tearDown(VariantID vid)
   deallocData(m_zu);
   deallocData(m_zv);
   deallocData(m_zz);
+  deallocData(m_zonal);
 }
 
 } // end namespace lcals
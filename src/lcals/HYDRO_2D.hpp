@@ -120,6 +120,10 @@ public:
 
   ~HYDRO_2D();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+  Index_type getFusedBytesPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -127,8 +131,13 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
+  void runFusedVariant(VariantID vid);
 
 private:
+  template <typename FIELD_PTR>
+  void runDataLayoutVariant(VariantID vid);
+
   Real_ptr m_za;
   Real_ptr m_zb;
   Real_ptr m_zm;
@@ -142,6 +151,8 @@ private:
   Real_ptr m_zrout;
   Real_ptr m_zzout;
 
+  Real_ptr m_zonal;  // arrays above packed in AoS or AoSoA layout
+
   Real_type m_s;
   Real_type m_t;
 
@@ -38,12 +38,26 @@ INT_PREDICT::INT_PREDICT(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(4000);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 INT_PREDICT::~INT_PREDICT() 
 {
 }
 
+Index_type INT_PREDICT::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 10*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type INT_PREDICT::getFLOPsPerRep() const
+{
+  return 17 * getRunSize();
+}
+
 void INT_PREDICT::setUp(VariantID vid)
 {
   m_array_length = getRunSize() * 13;
@@ -145,6 +159,14 @@ void INT_PREDICT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
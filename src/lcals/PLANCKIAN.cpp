@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
 
 #include <iostream>
 #include <cmath>
@@ -34,12 +35,30 @@ PLANCKIAN::PLANCKIAN(const RunParams& params)
 {
    setDefaultSize(100000);
    setDefaultReps(460);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 PLANCKIAN::~PLANCKIAN() 
 {
 }
 
+Index_type PLANCKIAN::getBytesPerRep() const
+{
+  return (2*sizeof(Real_type) + 3*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type PLANCKIAN::getFLOPsPerRep() const
+{
+  return 4 * getRunSize();
+}
+
 void PLANCKIAN::setUp(VariantID vid)
 {
   allocAndInitData(m_x, getRunSize(), vid);
@@ -94,6 +113,47 @@ void PLANCKIAN::runKernel(VariantID vid)
     }
 #endif // RUN_RAJA_SEQ
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      PLANCKIAN_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          PLANCKIAN_BODY_SIMD;
+        }
+        for ( ; i < iend; ++i ) {
+          PLANCKIAN_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      PLANCKIAN_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PLANCKIAN_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
     case Base_OpenMP : {
 
@@ -132,6 +192,14 @@ void PLANCKIAN::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -24,6 +24,13 @@
   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 
 
+#define PLANCKIAN_BODY_SIMD  \
+  SIMDReal vy = simdLoad(&u[i]) / simdLoad(&v[i]); \
+  simdStore( &y[i], vy ); \
+  simdStore( &w[i], simdLoad(&x[i]) / \
+    ( simdApply(vy, [](Real_type val) { return exp(val); }) - simdSet1(1.0) ) );
+
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf 
@@ -41,6 +48,9 @@ public:
 
   ~PLANCKIAN();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -48,6 +58,7 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_ptr m_x;
@@ -118,15 +118,15 @@ void POLYBENCH_2MM::runOpenMPTargetVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                          RAJA::RangeSegment{0, nj},
                          RAJA::RangeSegment{0, nk}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=](Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+        [=](Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
           POLYBENCH_2MM_BODY1_RAJA;
         },
-        [=](Index_type i, Index_type j, Index_type k, Real_type &dot) {
+        [=](Index_type i, Index_type j, Index_type k, Accum_type &dot) {
           POLYBENCH_2MM_BODY2_RAJA;
         },
-        [=](Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+        [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
           POLYBENCH_2MM_BODY3_RAJA;
         }
       );
@@ -135,15 +135,15 @@ void POLYBENCH_2MM::runOpenMPTargetVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                          RAJA::RangeSegment{0, nl},
                          RAJA::RangeSegment{0, nj}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=](Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+        [=](Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
           POLYBENCH_2MM_BODY4_RAJA;
         },
-        [=](Index_type i, Index_type l, Index_type j, Real_type &dot) {
+        [=](Index_type i, Index_type l, Index_type j, Accum_type &dot) {
           POLYBENCH_2MM_BODY5_RAJA;
         },
-        [=](Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+        [=](Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
           POLYBENCH_2MM_BODY6_RAJA;
         }
       );
@@ -68,11 +68,22 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_ni*m_nj*(1+m_nk) + m_ni*m_nl*(1+m_nj) );
+  m_ni = getScaledDim(m_ni, 2);
+  m_nj = getScaledDim(m_nj, 2);
+  m_nk = getScaledDim(m_nk, 2);
+  m_nl = getScaledDim(m_nl, 2);
+  setRunSize( m_ni*m_nj*(1+m_nk) + m_ni*m_nl*(1+m_nj) );
   setDefaultReps(run_reps);
 
   m_alpha = 1.5;
   m_beta = 1.2;
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
 }
 
 POLYBENCH_2MM::~POLYBENCH_2MM() 
@@ -80,6 +91,21 @@ POLYBENCH_2MM::~POLYBENCH_2MM()
 
 }
 
+Index_type POLYBENCH_2MM::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ni * m_nj +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ni * m_nk +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nk * m_nj +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nj * m_nl +
+         (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ni * m_nl;
+}
+
+Index_type POLYBENCH_2MM::getFLOPsPerRep() const
+{
+  return 3 * m_ni * m_nj * m_nk +
+         2 * m_ni * m_nl * m_nj;
+}
+
 void POLYBENCH_2MM::setUp(VariantID vid)
 {
   (void) vid;
@@ -161,15 +187,15 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
  
-          [=](Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+          [=](Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY1_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type k, Real_type &dot) {
+          [=](Index_type i, Index_type j, Index_type k, Accum_type &dot) {
             POLYBENCH_2MM_BODY2_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+          [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY3_RAJA;
           }
         );
@@ -178,15 +204,15 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=](Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+          [=](Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY4_RAJA;
           },
-          [=](Index_type i, Index_type l, Index_type j, Real_type &dot) {
+          [=](Index_type i, Index_type l, Index_type j, Accum_type &dot) {
             POLYBENCH_2MM_BODY5_RAJA;
           },
-          [=](Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+          [=](Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY6_RAJA;
           }
         );
@@ -283,15 +309,15 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=](Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+          [=](Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY1_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type k, Real_type &dot) {
+          [=](Index_type i, Index_type j, Index_type k, Accum_type &dot) {
             POLYBENCH_2MM_BODY2_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+          [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY3_RAJA;
           }
         );
@@ -300,15 +326,15 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=](Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+          [=](Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY4_RAJA;
           },
-          [=](Index_type i, Index_type l, Index_type j, Real_type &dot) {
+          [=](Index_type i, Index_type l, Index_type j, Accum_type &dot) {
             POLYBENCH_2MM_BODY5_RAJA;
           },
-          [=](Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+          [=](Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_2MM_BODY6_RAJA;
           }
         );
@@ -320,6 +346,17 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -37,7 +37,7 @@
 #define RAJAPerf_POLYBENCH_2MM_HPP
 
 #define POLYBENCH_2MM_BODY1 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_2MM_BODY2 \
   dot += alpha * A[k + i*nk] * B[j + k*nj];
@@ -46,7 +46,7 @@
   tmp[j + i*nj] = dot;
 
 #define POLYBENCH_2MM_BODY4 \
-  Real_type dot = beta;
+  Accum_type dot = beta;
 
 #define POLYBENCH_2MM_BODY5 \
   dot += tmp[j + i*nj] * C[l + j*nl];
@@ -103,6 +103,8 @@ public:
 
   ~POLYBENCH_2MM();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -110,6 +112,10 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_ni;
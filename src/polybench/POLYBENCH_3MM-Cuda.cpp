@@ -154,15 +154,15 @@ void POLYBENCH_3MM::runCudaVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                          RAJA::RangeSegment{0, nj},
                          RAJA::RangeSegment{0, nk}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+        [=] __device__ (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY1_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type j, Index_type k, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type j, Index_type k, Accum_type &dot) {
           POLYBENCH_3MM_BODY2_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY3_RAJA;
         }
 
@@ -172,15 +172,15 @@ void POLYBENCH_3MM::runCudaVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, nj},
                          RAJA::RangeSegment{0, nl},
                          RAJA::RangeSegment{0, nm}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Real_type &dot) {
+        [=] __device__ (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY4_RAJA;
         },
-        [=] __device__ (Index_type j, Index_type l, Index_type m, Real_type &dot) {
+        [=] __device__ (Index_type j, Index_type l, Index_type m, Accum_type &dot) {
           POLYBENCH_3MM_BODY5_RAJA;
         },
-        [=] __device__ (Index_type j, Index_type l, Index_type /*m*/, Real_type &dot) {
+        [=] __device__ (Index_type j, Index_type l, Index_type /*m*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY6_RAJA;
         }
 
@@ -190,15 +190,15 @@ void POLYBENCH_3MM::runCudaVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                          RAJA::RangeSegment{0, nl},
                          RAJA::RangeSegment{0, nj}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+        [=] __device__ (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY7_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type l, Index_type j, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type l, Index_type j, Accum_type &dot) {
           POLYBENCH_3MM_BODY8_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY9_RAJA;
         }
 
@@ -134,15 +134,15 @@ void POLYBENCH_3MM::runOpenMPTargetVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                          RAJA::RangeSegment{0, nj},
                          RAJA::RangeSegment{0, nk}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+        [=] (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY1_RAJA;
         },
-        [=] (Index_type i, Index_type j, Index_type k, Real_type &dot) {
+        [=] (Index_type i, Index_type j, Index_type k, Accum_type &dot) {
           POLYBENCH_3MM_BODY2_RAJA;
         },
-        [=] (Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+        [=] (Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY3_RAJA;
         }
 
@@ -152,15 +152,15 @@ void POLYBENCH_3MM::runOpenMPTargetVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, nj},
                          RAJA::RangeSegment{0, nl},
                          RAJA::RangeSegment{0, nm}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Real_type &dot) {
+        [=] (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY4_RAJA;
         },
-        [=] (Index_type j, Index_type l, Index_type m, Real_type &dot) {
+        [=] (Index_type j, Index_type l, Index_type m, Accum_type &dot) {
           POLYBENCH_3MM_BODY5_RAJA;
         },
-        [=] (Index_type j, Index_type l, Index_type /*m*/, Real_type &dot) {
+        [=] (Index_type j, Index_type l, Index_type /*m*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY6_RAJA;
         }
 
@@ -170,15 +170,15 @@ void POLYBENCH_3MM::runOpenMPTargetVariant(VariantID vid)
         RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                          RAJA::RangeSegment{0, nl},
                          RAJA::RangeSegment{0, nj}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+        [=] (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY7_RAJA;
         },
-        [=] (Index_type i, Index_type l, Index_type j, Real_type &dot) {
+        [=] (Index_type i, Index_type l, Index_type j, Accum_type &dot) {
           POLYBENCH_3MM_BODY8_RAJA;
         },
-        [=] (Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+        [=] (Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
           POLYBENCH_3MM_BODY9_RAJA;
         }
 
@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_3MM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TileUtils.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_3MM_DATA_SETUP_TILED \
+  const Index_type ni = m_ni; \
+  const Index_type nj = m_nj; \
+  const Index_type nk = m_nk; \
+  const Index_type nl = m_nl; \
+  const Index_type nm = m_nm; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr B = m_B; \
+  Real_ptr C = m_C; \
+  Real_ptr D = m_D; \
+  Real_ptr E = m_E; \
+  Real_ptr F = m_F; \
+  Real_ptr G = m_G;
+
+
+//
+// All three matrix products are tiled as in POLYBENCH_GEMM tiled variants.
+//
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+void POLYBENCH_3MM::runTiledVariantImpl()
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP_TILED;
+
+  POLYBENCH_3MM_VIEWS_RAJA;
+
+  const Index_type nib = (ni + RB - 1) / RB;
+  const Index_type njb = (nj + RB - 1) / RB;
+
+  using EXEC_POL = TiledMatMulPolicy<TILE, RB, OUTER_POL>;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel_param<EXEC_POL>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nib},
+                       RAJA::RangeSegment{0, nj},
+                       RAJA::RangeSegment{0, nk}),
+      RAJA::make_tuple(TileAccum<RB*TILE>()),
+
+      [=](Index_type ib, Index_type j, Index_type /*k*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type) {
+          dot.v[r*TILE + j % TILE] = 0.0;
+        });
+      },
+      [=](Index_type ib, Index_type j, Index_type k,
+          TileAccum<RB*TILE> &dot) {
+        const Real_type b = Bview(k, j);
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type i) {
+          dot.v[r*TILE + j % TILE] += Aview(i, k) * b;
+        });
+      },
+      [=](Index_type ib, Index_type j, Index_type /*k*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type i) {
+          Eview(i, j) = dot.v[r*TILE + j % TILE];
+        });
+      }
+    );
+
+    RAJA::kernel_param<EXEC_POL>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, njb},
+                       RAJA::RangeSegment{0, nl},
+                       RAJA::RangeSegment{0, nm}),
+      RAJA::make_tuple(TileAccum<RB*TILE>()),
+
+      [=](Index_type jb, Index_type l, Index_type /*m*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(jb, nj, [&](Index_type r, Index_type) {
+          dot.v[r*TILE + l % TILE] = 0.0;
+        });
+      },
+      [=](Index_type jb, Index_type l, Index_type m,
+          TileAccum<RB*TILE> &dot) {
+        const Real_type d = Dview(m, l);
+        forRegisterBlock<RB>(jb, nj, [&](Index_type r, Index_type j) {
+          dot.v[r*TILE + l % TILE] += Cview(j, m) * d;
+        });
+      },
+      [=](Index_type jb, Index_type l, Index_type /*m*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(jb, nj, [&](Index_type r, Index_type j) {
+          Fview(j, l) = dot.v[r*TILE + l % TILE];
+        });
+      }
+    );
+
+    RAJA::kernel_param<EXEC_POL>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nib},
+                       RAJA::RangeSegment{0, nl},
+                       RAJA::RangeSegment{0, nj}),
+      RAJA::make_tuple(TileAccum<RB*TILE>()),
+
+      [=](Index_type ib, Index_type l, Index_type /*j*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type) {
+          dot.v[r*TILE + l % TILE] = 0.0;
+        });
+      },
+      [=](Index_type ib, Index_type l, Index_type j,
+          TileAccum<RB*TILE> &dot) {
+        const Real_type f = Fview(j, l);
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type i) {
+          dot.v[r*TILE + l % TILE] += Eview(i, j) * f;
+        });
+      },
+      [=](Index_type ib, Index_type l, Index_type /*j*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type i) {
+          Gview(i, l) = dot.v[r*TILE + l % TILE];
+        });
+      }
+    );
+
+  }
+  stopTimer();
+}
+
+void POLYBENCH_3MM::runTiledVariant(VariantID vid)
+{
+  dispatchTiledVariant(*this, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
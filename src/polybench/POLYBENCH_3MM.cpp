@@ -68,14 +68,44 @@ POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
       break;
   }
 
-  setDefaultSize(m_ni*m_nj*(1+m_nk) + m_nj*m_nl*(1+m_nm) + m_ni*m_nl*(1+m_nj));
+  m_ni = getScaledDim(m_ni, 2);
+  m_nj = getScaledDim(m_nj, 2);
+  m_nk = getScaledDim(m_nk, 2);
+  m_nl = getScaledDim(m_nl, 2);
+  m_nm = getScaledDim(m_nm, 2);
+  setRunSize(m_ni*m_nj*(1+m_nk) + m_nj*m_nl*(1+m_nm) + m_ni*m_nl*(1+m_nj));
   setDefaultReps(m_run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
 }
 
 POLYBENCH_3MM::~POLYBENCH_3MM() 
 {
 }
 
+Index_type POLYBENCH_3MM::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ni * m_nj +
+         (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nj * m_nl +
+         (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ni * m_nl +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ni * m_nk +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nk * m_nj +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nj * m_nm +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nm * m_nl;
+}
+
+Index_type POLYBENCH_3MM::getFLOPsPerRep() const
+{
+  return 2 * m_ni * m_nj * m_nk +
+         2 * m_nj * m_nl * m_nm +
+         2 * m_ni * m_nl * m_nj;
+}
+
 void POLYBENCH_3MM::setUp(VariantID vid)
 {
   (void) vid;
@@ -169,15 +199,15 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+          [=] (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY1_RAJA;
           },
-          [=] (Index_type i, Index_type j, Index_type k, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Index_type k, Accum_type &dot) {
             POLYBENCH_3MM_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY3_RAJA;
           }
 
@@ -187,15 +217,15 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nm}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Real_type &dot) {
+          [=] (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY4_RAJA;
           },
-          [=] (Index_type j, Index_type l, Index_type m, Real_type &dot) {
+          [=] (Index_type j, Index_type l, Index_type m, Accum_type &dot) {
             POLYBENCH_3MM_BODY5_RAJA;
           },
-          [=] (Index_type j, Index_type l, Index_type /*m*/, Real_type &dot) {
+          [=] (Index_type j, Index_type l, Index_type /*m*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY6_RAJA;
           }
 
@@ -205,15 +235,15 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+          [=] (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY7_RAJA;
           },
-          [=] (Index_type i, Index_type l, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type l, Index_type j, Accum_type &dot) {
             POLYBENCH_3MM_BODY8_RAJA;
           },
-          [=] (Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+          [=] (Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY9_RAJA;
           }
 
@@ -325,15 +355,15 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Real_type &dot) {
+          [=] (Index_type /*i*/, Index_type /*j*/, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY1_RAJA;
           },
-          [=] (Index_type i, Index_type j, Index_type k, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Index_type k, Accum_type &dot) {
             POLYBENCH_3MM_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type j, Index_type /*k*/, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Index_type /*k*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY3_RAJA;
           }
 
@@ -343,15 +373,15 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nm}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Real_type &dot) {
+          [=] (Index_type /*j*/, Index_type /*l*/, Index_type /*m*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY4_RAJA;
           },
-          [=] (Index_type j, Index_type l, Index_type m, Real_type &dot) {
+          [=] (Index_type j, Index_type l, Index_type m, Accum_type &dot) {
             POLYBENCH_3MM_BODY5_RAJA;
           },
-          [=] (Index_type j, Index_type l, Index_type /*m*/, Real_type &dot) {
+          [=] (Index_type j, Index_type l, Index_type /*m*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY6_RAJA;
           }
 
@@ -361,15 +391,15 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Real_type &dot) {
+          [=] (Index_type /*i*/, Index_type /*l*/, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY7_RAJA;
           },
-          [=] (Index_type i, Index_type l, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type l, Index_type j, Accum_type &dot) {
             POLYBENCH_3MM_BODY8_RAJA;
           },
-          [=] (Index_type i, Index_type l, Index_type /*j*/, Real_type &dot) {
+          [=] (Index_type i, Index_type l, Index_type /*j*/, Accum_type &dot) {
             POLYBENCH_3MM_BODY9_RAJA;
           }
 
@@ -382,6 +412,17 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
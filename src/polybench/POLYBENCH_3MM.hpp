@@ -43,7 +43,7 @@
 #define RAJAPerf_POLYBENCH_3MM_HPP
 
 #define POLYBENCH_3MM_BODY1 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_3MM_BODY2 \
   dot += A[k + i*nk] * B[j + k*nj];
@@ -52,7 +52,7 @@
   E[j + i*nj] = dot;
 
 #define POLYBENCH_3MM_BODY4 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_3MM_BODY5 \
   dot += C[m + j*nm] * D[l + m*nl];
@@ -61,7 +61,7 @@
   F[l + j*nl] = dot;
 
 #define POLYBENCH_3MM_BODY7 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_3MM_BODY8 \
   dot += E[j + i*nj] * F[l + j*nl];
@@ -128,6 +128,8 @@ public:
 
   ~POLYBENCH_3MM();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -135,6 +137,10 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_ni;
@@ -0,0 +1,327 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_ADI.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_LINE_SOLVE)
+
+#include "common/ThreadUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_ADI_DATA_SETUP_LINE_SOLVE \
+  const Index_type n = m_n; \
+  const Index_type tsteps = m_tsteps; \
+\
+  Real_type DX,DY,DT; \
+  Real_type B1,B2; \
+  Real_type mul1,mul2; \
+  Real_type a,b,c,d,e,f; \
+\
+  ResReal_ptr U = m_U; \
+  ResReal_ptr V = m_V; \
+  ResReal_ptr P = m_P; \
+  ResReal_ptr Q = m_Q;
+
+
+void POLYBENCH_ADI::runLineSolveVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  switch ( vid ) {
+
+    case Base_Seq_Lines : {
+
+      POLYBENCH_ADI_DATA_SETUP_LINE_SOLVE;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        POLYBENCH_ADI_BODY1;
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2_LINES;
+          }
+          for (Index_type j = 1; j < n-1; ++j) {
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY3_LINES;
+            }
+          }
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY4;
+          }
+          for (Index_type k = n-2; k >= 1; --k) {
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY5_LINES;
+            }
+          }
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Lines : {
+
+      POLYBENCH_ADI_DATA_SETUP_LINE_SOLVE;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        POLYBENCH_ADI_BODY1;
+
+        //
+        // Static schedules over the same lines give each thread the same
+        // lines in every column sweep loop, so those loops need no barrier.
+        //
+        #pragma omp parallel
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2_LINES;
+          }
+          for (Index_type j = 1; j < n-1; ++j) {
+            #pragma omp for schedule(static) nowait
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY3_LINES;
+            }
+          }
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY4;
+          }
+          for (Index_type k = n-2; k >= 1; --k) {
+            #pragma omp for schedule(static) nowait
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY5_LINES;
+            }
+          }
+          #pragma omp barrier
+
+          #pragma omp for schedule(static)
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Partition : {
+
+      POLYBENCH_ADI_DATA_SETUP_LINE_SOLVE;
+
+      //
+      // Rows [1, n-1) are split into one slab per thread; each thread runs
+      // the column sweep recurrences and the row sweep lines of its slab.
+      //
+      const Index_type nparts =
+        std::max(std::min(Index_type(getNumThreads()), n-2), Index_type(1));
+      auto part_begin = [=](Index_type ip) {
+        return 1 + ip*(n-2)/nparts;
+      };
+
+      std::vector<Real_type> coef(3*n, 0.0);
+      Real_ptr pc = &coef[0];
+      Real_ptr gc = &coef[n];
+      Real_ptr hc = &coef[2*n];
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        POLYBENCH_ADI_BODY1;
+
+        //
+        // Column sweep p (the same for every line) and products of the
+        // factors that carry q forward from the row before each slab and
+        // v back from the row after it.
+        //
+        pc[0] = 0.0;
+        for (Index_type j = 1; j < n-1; ++j) {
+          pc[j] = -c / (a * pc[j-1] + b);
+        }
+        for (Index_type ip = 0; ip < nparts; ++ip) {
+          const Index_type j0 = part_begin(ip);
+          const Index_type j1 = part_begin(ip+1);
+          Real_type g = 1.0;
+          for (Index_type j = j0; j < j1; ++j) {
+            g *= -a / (a * pc[j-1] + b);
+            gc[j] = g;
+          }
+          Real_type h = 1.0;
+          for (Index_type k = j1-1; k >= j0; --k) {
+            h *= pc[k];
+            hc[k] = h;
+          }
+        }
+
+        #pragma omp parallel
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          // Forward recurrence in each slab, from zero q before the slab
+          #pragma omp for schedule(static, 1)
+          for (Index_type ip = 0; ip < nparts; ++ip) {
+            const Index_type j0 = part_begin(ip);
+            const Index_type j1 = part_begin(ip+1);
+            Index_type jbegin = j0;
+            if ( ip == 0 ) {
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY2_LINES;
+              }
+            } else {
+              const Index_type j = j0;
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY3_PART_FIRST;
+              }
+              jbegin = j0 + 1;
+            }
+            for (Index_type j = jbegin; j < j1; ++j) {
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY3_PART;
+              }
+            }
+          }
+
+          // True q at the last row of each slab, slab by slab
+          #pragma omp for schedule(static)
+          for (Index_type i = 1; i < n-1; ++i) {
+            for (Index_type ip = 1; ip < nparts; ++ip) {
+              const Index_type j0 = part_begin(ip);
+              const Index_type j = part_begin(ip+1) - 1;
+              POLYBENCH_ADI_BODY3_PART_CARRY;
+            }
+          }
+
+          // True q at other rows, then backward recurrence in each slab
+          // from zero v after the slab
+          #pragma omp for schedule(static, 1)
+          for (Index_type ip = 0; ip < nparts; ++ip) {
+            const Index_type j0 = part_begin(ip);
+            const Index_type j1 = part_begin(ip+1);
+            if ( ip > 0 ) {
+              for (Index_type j = j0; j < j1-1; ++j) {
+                for (Index_type i = 1; i < n-1; ++i) {
+                  POLYBENCH_ADI_BODY3_PART_CARRY;
+                }
+              }
+            }
+            Index_type kbegin = j1 - 1;
+            if ( ip == nparts-1 ) {
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY4;
+              }
+            } else {
+              const Index_type k = j1 - 1;
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY5_PART_FIRST;
+              }
+              kbegin = j1 - 2;
+            }
+            for (Index_type k = kbegin; k >= j0; --k) {
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY5_PART;
+              }
+            }
+          }
+
+          // True v at the first row of each slab, slab by slab
+          #pragma omp for schedule(static)
+          for (Index_type i = 1; i < n-1; ++i) {
+            for (Index_type ip = nparts-2; ip >= 0; --ip) {
+              const Index_type k = part_begin(ip);
+              const Index_type j1 = part_begin(ip+1);
+              POLYBENCH_ADI_BODY5_PART_CARRY;
+            }
+          }
+
+          // True v at other rows
+          #pragma omp for schedule(static, 1)
+          for (Index_type ip = 0; ip < nparts-1; ++ip) {
+            const Index_type j0 = part_begin(ip);
+            const Index_type j1 = part_begin(ip+1);
+            for (Index_type k = j0+1; k < j1; ++k) {
+              for (Index_type i = 1; i < n-1; ++i) {
+                POLYBENCH_ADI_BODY5_PART_CARRY;
+              }
+            }
+          }
+
+          // Row sweep on the lines of each slab
+          #pragma omp for schedule(static, 1)
+          for (Index_type ip = 0; ip < nparts; ++ip) {
+            for (Index_type i = part_begin(ip); i < part_begin(ip+1); ++i) {
+              POLYBENCH_ADI_BODY6;
+              for (Index_type j = 1; j < n-1; ++j) {
+                POLYBENCH_ADI_BODY7;
+              }
+              POLYBENCH_ADI_BODY8;
+              for (Index_type k = n-2; k >= 1; --k) {
+                POLYBENCH_ADI_BODY9;
+              }
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\nPOLYBENCH_ADI  Unknown line solve variant id = "
+                << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_LINE_SOLVE
@@ -64,8 +64,17 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
       run_reps = 20;
       break;
   }
-  setDefaultSize( m_tsteps * 2*m_n*(m_n+m_n) );
+  m_n = getScaledDim(m_n, 2);
+  setRunSize( m_tsteps * 2*m_n*(m_n+m_n) );
   setDefaultReps(run_reps);
+
+#if defined(RUN_LINE_SOLVE)
+  setVariantDefined(Base_Seq_Lines);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_Lines);
+  setVariantDefined(Base_OpenMP_Partition);
+#endif
+#endif
 }
 
 POLYBENCH_ADI::~POLYBENCH_ADI() 
@@ -73,6 +82,17 @@ POLYBENCH_ADI::~POLYBENCH_ADI()
 
 }
 
+Index_type POLYBENCH_ADI::getBytesPerRep() const
+{
+  return m_tsteps * 2 *
+         (3*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_n-2) * (m_n-2);
+}
+
+Index_type POLYBENCH_ADI::getFLOPsPerRep() const
+{
+  return m_tsteps * 2 * (3 + 12 + 2) * (m_n-2) * (m_n-2);
+}
+
 void POLYBENCH_ADI::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_U, m_n * m_n, 0.0, vid);
@@ -321,6 +341,18 @@ void POLYBENCH_ADI::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_LINE_SOLVE)
+    case Base_Seq_Lines :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Lines :
+    case Base_OpenMP_Partition :
+#endif
+    {
+      runLineSolveVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
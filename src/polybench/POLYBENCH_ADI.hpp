@@ -57,6 +57,18 @@
 ///      }
 ///    }
 ///  }
+///
+/// The column sweep reads u and writes v down columns (stride N), one line
+/// (column i) at a time. The Base_Seq_Lines and Base_OpenMP_Lines variants
+/// run the column sweep on all lines at once, each step of the recurrence 
+/// an innermost loop over i, and keep p and q of that sweep transposed 
+/// (p[j][i]), so every access in both sweeps is unit-stride. The 
+/// Base_OpenMP_Partition variant also splits the rows of the grid into one
+/// slab per thread; in the column sweep, each slab solves the recurrences
+/// for its rows with a zero value coming in from the slab before it, and 
+/// the true values are found by a pass over slab boundaries and a final 
+/// correction (since p depends only on j, so does the factor each incoming
+/// value is multiplied by).
 
 
 
@@ -114,6 +126,47 @@
   U[i * n + k] = P[i * n + k] * U[i * n + k +1] + Q[i * n + k]; 
 
 
+#define POLYBENCH_ADI_BODY2_LINES \
+  V[0 * n + i] = 1.0; \
+  P[0 * n + i] = 0.0; \
+  Q[0 * n + i] = V[0 * n + i];
+
+#define POLYBENCH_ADI_BODY3_LINES \
+  P[j * n + i] = -c / (a * P[(j-1) * n + i] + b); \
+  Q[j * n + i] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                 f * U[j * n + i + 1] - a * Q[(j-1) * n + i]) / \
+                    (a * P[(j-1) * n + i] + b); 
+
+#define POLYBENCH_ADI_BODY5_LINES \
+  V[k * n + i]  = P[k * n + i] * V[(k+1) * n + i] + Q[k * n + i]; 
+
+//
+// Partition solver column sweep; pc[j] holds p[.][j] (same for all lines),
+// gc[j] and hc[k] products of factors within a slab [j0, j1).
+//
+#define POLYBENCH_ADI_BODY3_PART_FIRST \
+  Q[j * n + i] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                 f * U[j * n + i + 1]) / \
+                    (a * pc[j-1] + b); 
+
+#define POLYBENCH_ADI_BODY3_PART \
+  Q[j * n + i] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                 f * U[j * n + i + 1] - a * Q[(j-1) * n + i]) / \
+                    (a * pc[j-1] + b); 
+
+#define POLYBENCH_ADI_BODY3_PART_CARRY \
+  Q[j * n + i] += gc[j] * Q[(j0-1) * n + i];
+
+#define POLYBENCH_ADI_BODY5_PART_FIRST \
+  V[k * n + i]  = Q[k * n + i]; 
+
+#define POLYBENCH_ADI_BODY5_PART \
+  V[k * n + i]  = pc[k] * V[(k+1) * n + i] + Q[k * n + i]; 
+
+#define POLYBENCH_ADI_BODY5_PART_CARRY \
+  V[k * n + i] += hc[k] * V[j1 * n + i];
+
+
 #define POLYBENCH_ADI_BODY2_RAJA \
   Vview(0, i) = 1.0; \
   Pview(i, 0) = 0.0; \
@@ -177,6 +230,9 @@ public:
 
   ~POLYBENCH_ADI();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
  
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -184,6 +240,7 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runLineSolveVariant(VariantID vid);
 
 private:
   Index_type m_n;
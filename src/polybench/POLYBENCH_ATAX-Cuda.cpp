@@ -141,15 +141,15 @@ void POLYBENCH_ATAX::runCudaVariant(VariantID vid)
       RAJA::kernel_param<EXEC_POL1>( 
         RAJA::make_tuple(RAJA::RangeSegment{0, N},
                          RAJA::RangeSegment{0, N}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
           POLYBENCH_ATAX_BODY1_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type j, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type j, Accum_type &dot) {
           POLYBENCH_ATAX_BODY2_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
           POLYBENCH_ATAX_BODY3_RAJA;
         }
 
@@ -158,15 +158,15 @@ void POLYBENCH_ATAX::runCudaVariant(VariantID vid)
       RAJA::kernel_param<EXEC_POL2>( 
         RAJA::make_tuple(RAJA::RangeSegment{0, N},
                          RAJA::RangeSegment{0, N}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type /* i */, Index_type j, Real_type &dot) {
+        [=] __device__ (Index_type /* i */, Index_type j, Accum_type &dot) {
           POLYBENCH_ATAX_BODY4_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type j , Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type j , Accum_type &dot) {
           POLYBENCH_ATAX_BODY5_RAJA;
         },
-        [=] __device__ (Index_type /* i */, Index_type j, Real_type &dot) {
+        [=] __device__ (Index_type /* i */, Index_type j, Accum_type &dot) {
           POLYBENCH_ATAX_BODY6_RAJA;
         }
 
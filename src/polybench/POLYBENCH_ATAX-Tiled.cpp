@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_ATAX.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TileUtils.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_ATAX_DATA_SETUP_TILED \
+  const Index_type N = m_N; \
+\
+  Real_ptr tmp = m_tmp; \
+  Real_ptr y = m_y; \
+  Real_ptr x = m_x; \
+  Real_ptr A = m_A;
+
+
+//
+// tmp = A*x is computed for RB rows of A at a time. y = A^T*tmp is tiled
+// by columns of A (entries of y), and tiles of rows of A are added in
+// order, so each tile of y stays in cache while it is updated.
+//
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+void POLYBENCH_ATAX::runTiledVariantImpl()
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP_TILED;
+
+  POLYBENCH_ATAX_VIEWS_RAJA;
+
+  const Index_type nib = (N + RB - 1) / RB;
+
+  using EXEC_POL1 = TiledRowDotPolicy<TILE, RB, OUTER_POL>;
+
+  using EXEC_POL2 =
+    RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::statement::tile_fixed<TILE>, OUTER_POL,
+        RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE/RB>,
+                                 RAJA::loop_exec,
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel_param<EXEC_POL1>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nib},
+                       RAJA::RangeSegment{0, N}),
+      RAJA::make_tuple(TileAccum<RB>()),
+
+      [=] (Index_type ib, Index_type /* j */, TileAccum<RB> &dot) {
+        forRegisterBlock<RB>(ib, N, [&](Index_type r, Index_type i) {
+          yview(i) = 0.0;
+          dot.v[r] = 0.0;
+        });
+      },
+      [=] (Index_type ib, Index_type j, TileAccum<RB> &dot) {
+        const Real_type xj = xview(j);
+        forRegisterBlock<RB>(ib, N, [&](Index_type r, Index_type i) {
+          dot.v[r] += Aview(i, j) * xj;
+        });
+      },
+      [=] (Index_type ib, Index_type /* j */, TileAccum<RB> &dot) {
+        forRegisterBlock<RB>(ib, N, [&](Index_type r, Index_type i) {
+          tmpview(i) = dot.v[r];
+        });
+      }
+    );
+
+    RAJA::kernel<EXEC_POL2>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nib},
+                       RAJA::RangeSegment{0, N}),
+
+      [=] (Index_type ib, Index_type j) {
+        Accum_type dot = yview(j);
+        forRegisterBlock<RB>(ib, N, [&](Index_type, Index_type i) {
+          dot += Aview(i, j) * tmpview(i);
+        });
+        yview(j) = dot;
+      }
+    );
+
+  }
+  stopTimer();
+}
+
+void POLYBENCH_ATAX::runTiledVariant(VariantID vid)
+{
+  dispatchTiledVariant(*this, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
@@ -58,8 +58,25 @@ POLYBENCH_ATAX::POLYBENCH_ATAX(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_N + m_N*2*m_N );
+  m_N = getScaledDim(m_N, 2);
+  setRunSize( m_N + m_N*2*m_N );
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
+
+#if defined(RUN_BATCHED)
+  if ( lsizespec == Mini || lsizespec == Small ) {
+    setVariantDefined(Base_Seq_Batched);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    setVariantDefined(Base_OpenMP_Batched);
+#endif
+  }
+#endif
 }
 
 POLYBENCH_ATAX::~POLYBENCH_ATAX()
@@ -67,13 +84,24 @@ POLYBENCH_ATAX::~POLYBENCH_ATAX()
 
 }
 
+Index_type POLYBENCH_ATAX::getBytesPerRep() const
+{
+  return (3*sizeof(Real_type) + 3*sizeof(Real_type)) * m_N +
+         (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_N * m_N;
+}
+
+Index_type POLYBENCH_ATAX::getFLOPsPerRep() const
+{
+  return 4 * m_N * m_N;
+}
+
 void POLYBENCH_ATAX::setUp(VariantID vid)
 {
-  (void) vid;
-  allocAndInitData(m_tmp, m_N, vid);
-  allocAndInitData(m_x, m_N, vid);
-  allocAndInitData(m_A, m_N * m_N, vid);
-  allocAndInitDataConst(m_y, m_N, 0.0, vid);
+  const Index_type nbatch = getBatchSize(vid);
+  allocAndInitData(m_tmp, m_N * nbatch, vid);
+  allocAndInitData(m_x, m_N * nbatch, vid);
+  allocAndInitData(m_A, m_N * m_N * nbatch, vid);
+  allocAndInitDataConst(m_y, m_N * nbatch, 0.0, vid);
 }
 
 void POLYBENCH_ATAX::runKernel(VariantID vid)
@@ -150,15 +178,15 @@ void POLYBENCH_ATAX::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL1>( 
           RAJA::make_tuple(RAJA::RangeSegment{0, N}, 
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_ATAX_BODY1_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_ATAX_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_ATAX_BODY3_RAJA;
           }
 
@@ -167,15 +195,15 @@ void POLYBENCH_ATAX::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL2>( 
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /* i */, Index_type j, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type j, Accum_type &dot) {
             POLYBENCH_ATAX_BODY4_RAJA;
           },
-          [=] (Index_type i, Index_type j , Real_type &dot) {
+          [=] (Index_type i, Index_type j , Accum_type &dot) {
             POLYBENCH_ATAX_BODY5_RAJA;
           },
-          [=] (Index_type /* i */, Index_type j, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type j, Accum_type &dot) {
             POLYBENCH_ATAX_BODY6_RAJA;
           }
 
@@ -256,15 +284,15 @@ void POLYBENCH_ATAX::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL1>( 
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_ATAX_BODY1_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_ATAX_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_ATAX_BODY3_RAJA;
           }
 
@@ -273,15 +301,15 @@ void POLYBENCH_ATAX::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL2>( 
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /* i */, Index_type j, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type j, Accum_type &dot) {
             POLYBENCH_ATAX_BODY4_RAJA;
           },
-          [=] (Index_type i, Index_type j , Real_type &dot) {
+          [=] (Index_type i, Index_type j , Accum_type &dot) {
             POLYBENCH_ATAX_BODY5_RAJA;
           },
-          [=] (Index_type /* i */, Index_type j, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type j, Accum_type &dot) {
             POLYBENCH_ATAX_BODY6_RAJA;
           }
 
@@ -294,6 +322,28 @@ void POLYBENCH_ATAX::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
+#if defined(RUN_BATCHED)
+    case Base_Seq_Batched :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Batched :
+#endif
+    {
+      runBatchedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -29,7 +29,7 @@
 
 #define POLYBENCH_ATAX_BODY1 \
   y[i] = 0.0; \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_ATAX_BODY2 \
   dot += A[j + i*N] * x[j];
@@ -38,7 +38,7 @@
   tmp[i] = dot;
 
 #define POLYBENCH_ATAX_BODY4 \
-  Real_type dot = y[j];
+  Accum_type dot = y[j];
 
 #define POLYBENCH_ATAX_BODY5 \
   dot += A[j + i*N] * tmp[i];
@@ -98,6 +98,8 @@ public:
 
   ~POLYBENCH_ATAX();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -105,6 +107,11 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+  void runBatchedVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_N;
@@ -0,0 +1,235 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FDTD_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_FUSED)
+
+#include "common/ThreadUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_FDTD_2D_DATA_SETUP_FUSED \
+  const Index_type nx = m_nx; \
+  const Index_type ny = m_ny; \
+  const Index_type tsteps = m_tsteps; \
+\
+  ResReal_ptr fict = m_fict; \
+  ResReal_ptr ex = m_ex; \
+  ResReal_ptr ey = m_ey; \
+  ResReal_ptr hz = m_hz;
+
+
+//
+// The ey and ex updates of row i (BODY1 or BODY2, and BODY3) read hz rows
+// i-1 and i, and the hz update of row i (BODY4) reads ey rows i and i+1.
+// So each time step is one loop over rows that updates ey and ex on row i
+// and then hz on row i-1, which reads ex and ey while still in cache and 
+// writes hz after the last read of its old values.
+//
+// In OpenMP variants, each thread runs the fused loop on a chunk of rows
+// [i0, i1); the hz update of row i1-1, which reads ey of the first row of
+// the next chunk, runs after all chunks finish. The last row of hz is not
+// updated, so sequential variants run the fused loop on one chunk.
+//
+Index_type POLYBENCH_FDTD_2D::getFusedBytesPerRep() const
+{
+  return m_tsteps *
+         ( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ny +
+           (1*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_nx-1) * m_ny +
+           (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nx * (m_ny-1) +
+           (1*sizeof(Real_type) + 0*sizeof(Real_type)) * (m_nx-1) * (m_ny-1) +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nx * m_ny );
+}
+
+void POLYBENCH_FDTD_2D::runFusedVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FDTD_2D_DATA_SETUP_FUSED;
+
+  const Index_type nchunks =
+    std::max(std::min(Index_type(getNumThreads()), nx), Index_type(1));
+  auto chunk_begin = [=](Index_type ic) {
+    return ic*nx/nchunks;
+  };
+
+  auto e_row = [=](Index_type t, Index_type i) {
+    if ( i == 0 ) {
+      for (Index_type j = 0; j < ny; j++) {
+        POLYBENCH_FDTD_2D_BODY1;
+      }
+    } else {
+      for (Index_type j = 0; j < ny; j++) {
+        POLYBENCH_FDTD_2D_BODY2;
+      }
+    }
+    for (Index_type j = 1; j < ny; j++) {
+      POLYBENCH_FDTD_2D_BODY3;
+    }
+  };
+  auto h_row = [=](Index_type i) {
+    for (Index_type j = 0; j < ny - 1; j++) {
+      POLYBENCH_FDTD_2D_BODY4;
+    }
+  };
+  auto fused_rows = [=](Index_type t, Index_type i0, Index_type i1) {
+    for (Index_type i = i0; i < i1; i++) {
+      e_row(t, i);
+      if ( i > i0 ) {
+        h_row(i-1);
+      }
+    }
+  };
+
+  POLYBENCH_FDTD_2D_VIEWS_RAJA;
+
+  auto raja_e_row = [=](Index_type t, Index_type i) {
+    if ( i == 0 ) {
+      RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(0, ny),
+        [=](Index_type j) {
+        POLYBENCH_FDTD_2D_BODY1_RAJA;
+      });
+    } else {
+      RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(0, ny),
+        [=](Index_type j) {
+        POLYBENCH_FDTD_2D_BODY2_RAJA;
+      });
+    }
+    RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(1, ny),
+      [=](Index_type j) {
+      POLYBENCH_FDTD_2D_BODY3_RAJA;
+    });
+  };
+  auto raja_h_row = [=](Index_type i) {
+    RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(0, ny-1),
+      [=](Index_type j) {
+      POLYBENCH_FDTD_2D_BODY4_RAJA;
+    });
+  };
+  auto raja_fused_rows = [=](Index_type t, Index_type i0, Index_type i1) {
+    RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(i0, i1),
+      [=](Index_type i) {
+      raja_e_row(t, i);
+      if ( i > i0 ) {
+        raja_h_row(i-1);
+      }
+    });
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          fused_rows(t, 0, nx);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          raja_fused_rows(t, 0, nx);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          #pragma omp for schedule(static, 1)
+          for (Index_type ic = 0; ic < nchunks; ++ic) {
+            fused_rows(t, chunk_begin(ic), chunk_begin(ic+1));
+          }
+
+          #pragma omp for schedule(static, 1)
+          for (Index_type ic = 0; ic < nchunks; ++ic) {
+            const Index_type i = chunk_begin(ic+1) - 1;
+            if ( i < nx - 1 ) {
+              h_row(i);
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, nchunks), [=](Index_type ic) {
+            raja_fused_rows(t, chunk_begin(ic), chunk_begin(ic+1));
+          });
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, nchunks), [=](Index_type ic) {
+            const Index_type i = chunk_begin(ic+1) - 1;
+            if ( i < nx - 1 ) {
+              raja_h_row(i);
+            }
+          });
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  POLYBENCH_FDTD_2D : Unknown fused variant id = "
+                << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_FUSED
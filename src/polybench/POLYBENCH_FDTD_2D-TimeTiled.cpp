@@ -0,0 +1,136 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FDTD_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TimeTileUtils.hpp"
+#include "common/ThreadUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_FDTD_2D_DATA_SETUP_TIME_TILED \
+  const Index_type nx = m_nx; \
+  const Index_type ny = m_ny; \
+  const Index_type tsteps = m_tsteps; \
+\
+  ResReal_ptr fict = m_fict; \
+  ResReal_ptr ex = m_ex; \
+  ResReal_ptr ey = m_ey; \
+  ResReal_ptr hz = m_hz;
+
+
+//
+// Stage 0 of time step t updates rows i of ey (from hz rows i-1 and i)
+// and ex (from hz row i); stage 1 updates rows i of hz (from ex row i and
+// ey rows i and i+1). So stage 0 tiles shrink by one row on the left per
+// time step, and stage 1 tiles by one more row on the right.
+//
+struct FDTD_2D_Shrink
+{
+  void operator()(Index_type t, Index_type s,
+                  Index_type& left, Index_type& right) const
+  {
+    left = t;
+    right = t + s;
+  }
+};
+
+void POLYBENCH_FDTD_2D::runTimeTiledVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type block_steps = run_params.getTimeBlock();
+
+  POLYBENCH_FDTD_2D_DATA_SETUP_TIME_TILED;
+
+  auto stage = [=](Index_type t, Index_type s,
+                   Index_type lo, Index_type hi) {
+    if ( s == 0 ) {
+      for (Index_type i = lo; i < hi; i++) {
+        if ( i == 0 ) {
+          for (Index_type j = 0; j < ny; j++) {
+            POLYBENCH_FDTD_2D_BODY1;
+          }
+        } else {
+          for (Index_type j = 0; j < ny; j++) {
+            POLYBENCH_FDTD_2D_BODY2;
+          }
+        }
+        for (Index_type j = 1; j < ny; j++) {
+          POLYBENCH_FDTD_2D_BODY3;
+        }
+      }
+    } else {
+      for (Index_type i = lo; i < std::min(hi, nx - 1); i++) {
+        for (Index_type j = 0; j < ny - 1; j++) {
+          POLYBENCH_FDTD_2D_BODY4;
+        }
+      }
+    }
+  };
+
+  const FDTD_2D_Shrink shrink{};
+
+  switch ( vid ) {
+
+    case Base_Seq_TimeTiled : {
+
+      const Index_type tile_rows =
+        getTimeTileRows(nx, 3*ny*sizeof(Real_type), 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forTimeTiles<false>(tsteps, 2, block_steps, 0, nx, tile_rows,
+                            shrink, stage);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_TimeTiled : {
+
+      const Index_type tile_rows =
+        getTimeTileRows(nx, 3*ny*sizeof(Real_type), getNumThreads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forTimeTiles<true>(tsteps, 2, block_steps, 0, nx, tile_rows,
+                           shrink, stage);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  POLYBENCH_FDTD_2D : Unknown time-tiled variant id = "
+                << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
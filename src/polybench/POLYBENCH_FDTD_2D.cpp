@@ -60,8 +60,26 @@ POLYBENCH_FDTD_2D::POLYBENCH_FDTD_2D(const RunParams& params)
       run_reps = 10;
       break;
   }
-  setDefaultSize( m_tsteps * (m_ny + 3 * m_nx*m_ny) );
+  m_nx = getScaledDim(m_nx, 2);
+  m_ny = getScaledDim(m_ny, 2);
+  setRunSize( m_tsteps * (m_ny + 3 * m_nx*m_ny) );
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(Base_Seq_TimeTiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_TimeTiled);
+#endif
+#endif
+
+#if defined(RUN_FUSED)
+  setVariantDefined(Base_Seq_Fused);
+  setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_Fused);
+  setVariantDefined(RAJA_OpenMP_Fused);
+#endif
+#endif
 }
 
 POLYBENCH_FDTD_2D::~POLYBENCH_FDTD_2D() 
@@ -69,6 +87,23 @@ POLYBENCH_FDTD_2D::~POLYBENCH_FDTD_2D()
 
 }
 
+Index_type POLYBENCH_FDTD_2D::getBytesPerRep() const
+{
+  return m_tsteps *
+         ( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ny +
+           (1*sizeof(Real_type) + 2*sizeof(Real_type)) * (m_nx-1) * m_ny +
+           (1*sizeof(Real_type) + 2*sizeof(Real_type)) * m_nx * (m_ny-1) +
+           (1*sizeof(Real_type) + 3*sizeof(Real_type)) * (m_nx-1) * (m_ny-1) );
+}
+
+Index_type POLYBENCH_FDTD_2D::getFLOPsPerRep() const
+{
+  return m_tsteps *
+         ( 3 * (m_nx-1) * m_ny +
+           3 * m_nx * (m_ny-1) +
+           5 * (m_nx-1) * (m_ny-1) );
+}
+
 void POLYBENCH_FDTD_2D::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_hz, m_nx * m_ny, 0.0, vid);
@@ -281,6 +316,30 @@ void POLYBENCH_FDTD_2D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case Base_Seq_TimeTiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_TimeTiled :
+#endif
+    {
+      runTimeTiledVariant(vid);
+      break;
+    }
+#endif
+
+#if defined(RUN_FUSED)
+    case Base_Seq_Fused :
+    case RAJA_Seq_Fused :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused :
+    case RAJA_OpenMP_Fused :
+#endif
+    {
+      runFusedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
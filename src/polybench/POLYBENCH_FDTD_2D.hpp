@@ -91,6 +91,9 @@ public:
 
   ~POLYBENCH_FDTD_2D();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+  Index_type getFusedBytesPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -98,6 +101,8 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTimeTiledVariant(VariantID vid);
+  void runFusedVariant(VariantID vid);
 
 private:
   Index_type m_nx;
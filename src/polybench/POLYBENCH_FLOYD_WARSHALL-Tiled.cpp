@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TileUtils.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_TILED \
+  const Index_type N = m_N; \
+\
+  Real_ptr pin = m_pin; \
+  Real_ptr pout = m_pout;
+
+
+//
+// Since pin is only read, each tile of pout depends only on rows of pin
+// in the tile, row k of pin, and column k, so tiles are independent (the
+// diagonal, row/column, and other tile phases of blocked Floyd-Warshall
+// on a matrix updated in place are not needed), and all steps k are run
+// on a tile while it is in cache. Each entry of pout is written for k in
+// order, as in other variants.
+//
+// Register blocks are not used: updating several rows of pout for each j
+// keeps compilers from vectorizing the loop over j, which costs more than
+// the loads of row k it saves. So variants are dispatched on tile size
+// only and RB is always 1. Segments are (i, j, k).
+//
+template <Index_type TILE, typename OUTER_POL>
+using TiledFloydWarshallPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE>, OUTER_POL,
+      RAJA::statement::Tile<1, RAJA::statement::tile_fixed<TILE>,
+                               RAJA::loop_exec,
+        RAJA::statement::For<2, RAJA::loop_exec,
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >
+  >;
+
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+void POLYBENCH_FLOYD_WARSHALL::runTiledVariantImpl()
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_TILED;
+
+  POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA;
+
+  using EXEC_POL = TiledFloydWarshallPolicy<TILE, OUTER_POL>;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel<EXEC_POL>(
+
+      RAJA::make_tuple( RAJA::RangeSegment{0, N},
+                        RAJA::RangeSegment{0, N},
+                        RAJA::RangeSegment{0, N} ),
+
+      [=](Index_type i, Index_type j, Index_type k) {
+        POLYBENCH_FLOYD_WARSHALL_BODY_RAJA;
+      }
+    );
+
+  }
+  stopTimer();
+}
+
+void POLYBENCH_FLOYD_WARSHALL::runTiledVariant(VariantID vid)
+{
+  dispatchTiledVariant<false>(*this, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
@@ -61,8 +61,16 @@ POLYBENCH_FLOYD_WARSHALL::POLYBENCH_FLOYD_WARSHALL(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_N*m_N*m_N );
+  m_N = getScaledDim(m_N, 2);
+  setRunSize( m_N*m_N*m_N );
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
 }
 
 POLYBENCH_FLOYD_WARSHALL::~POLYBENCH_FLOYD_WARSHALL() 
@@ -70,6 +78,17 @@ POLYBENCH_FLOYD_WARSHALL::~POLYBENCH_FLOYD_WARSHALL()
 
 }
 
+Index_type POLYBENCH_FLOYD_WARSHALL::getBytesPerRep() const
+{
+  return m_N *
+         (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_N * m_N;
+}
+
+Index_type POLYBENCH_FLOYD_WARSHALL::getFLOPsPerRep() const
+{
+  return m_N * m_N * m_N;
+}
+
 void POLYBENCH_FLOYD_WARSHALL::setUp(VariantID vid)
 {
   (void) vid;
@@ -218,6 +237,17 @@ void POLYBENCH_FLOYD_WARSHALL::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
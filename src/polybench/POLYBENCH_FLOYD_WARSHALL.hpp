@@ -61,6 +61,9 @@ public:
 
   ~POLYBENCH_FLOYD_WARSHALL();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+  bool usesRegisterBlock() const { return false; }
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -68,6 +71,10 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_N;
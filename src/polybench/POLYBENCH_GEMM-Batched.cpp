@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_BATCHED)
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_GEMM_DATA_SETUP_BATCHED \
+  const Index_type ni = m_ni; \
+  const Index_type nj = m_nj; \
+  const Index_type nk = m_nk; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+\
+  Real_ptr Abatch = m_A; \
+  Real_ptr Bbatch = m_B; \
+  Real_ptr Cbatch = m_C;
+
+//
+// Instance b of a batch uses the b-th ni x nk, nk x nj, and ni x nj
+// matrices of arrays A, B, and C. Instance 0 has the same data as in
+// other variants, and checksums are computed from it.
+//
+void POLYBENCH_GEMM::runBatchedVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type nbatch = getBatchSize(vid);
+
+  POLYBENCH_GEMM_DATA_SETUP_BATCHED;
+
+  auto instance = [=](Index_type b) {
+    ResReal_ptr A = Abatch + b*ni*nk;
+    ResReal_ptr B = Bbatch + b*nk*nj;
+    ResReal_ptr C = Cbatch + b*ni*nj;
+
+    for (Index_type i = 0; i < ni; ++i ) { 
+      for (Index_type j = 0; j < nj; ++j ) {
+        POLYBENCH_GEMM_BODY1;
+        for (Index_type k = 0; k < nk; ++k ) {
+           POLYBENCH_GEMM_BODY2;
+        }
+        POLYBENCH_GEMM_BODY3;
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq_Batched : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < nbatch; ++b) {
+          instance(b);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Batched : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nbatch; ++b) {
+          instance(b);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  POLYBENCH_GEMM : Unknown batched variant id = "
+                << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_BATCHED
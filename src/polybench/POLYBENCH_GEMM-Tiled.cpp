@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TileUtils.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_GEMM_DATA_SETUP_TILED \
+  const Index_type ni = m_ni; \
+  const Index_type nj = m_nj; \
+  const Index_type nk = m_nk; \
+\
+  Real_type alpha = m_alpha; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr B = m_B; \
+  Real_ptr C = m_C;
+
+
+//
+// C is tiled by rows and columns, so rows of a tile of B are reused from
+// cache for each block of rows of C. The innermost loop over j updates
+// dot products for RB rows of C with each value of B it loads. Products
+// are summed in Accum_type in order of k, as in other variants, and
+// stored in C when done.
+//
+// C[i][j] *= beta is not done since C[i][j] is then set to dot.
+//
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+void POLYBENCH_GEMM::runTiledVariantImpl()
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP_TILED;
+
+  POLYBENCH_GEMM_VIEWS_RAJA;
+
+  const Index_type nib = (ni + RB - 1) / RB;
+
+  using EXEC_POL = TiledMatMulPolicy<TILE, RB, OUTER_POL>;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel_param<EXEC_POL>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nib},
+                       RAJA::RangeSegment{0, nj},
+                       RAJA::RangeSegment{0, nk}),
+      RAJA::make_tuple(TileAccum<RB*TILE>()),
+
+      [=](Index_type ib, Index_type j, Index_type /*k*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type) {
+          dot.v[r*TILE + j % TILE] = 0.0;
+        });
+      },
+      [=](Index_type ib, Index_type j, Index_type k,
+          TileAccum<RB*TILE> &dot) {
+        const Real_type b = Bview(k, j);
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type i) {
+          dot.v[r*TILE + j % TILE] += alpha * Aview(i, k) * b;
+        });
+      },
+      [=](Index_type ib, Index_type j, Index_type /*k*/,
+          TileAccum<RB*TILE> &dot) {
+        forRegisterBlock<RB>(ib, ni, [&](Index_type r, Index_type i) {
+          Cview(i, j) = dot.v[r*TILE + j % TILE];
+        });
+      }
+    );
+
+  }
+  stopTimer();
+}
+
+void POLYBENCH_GEMM::runTiledVariant(VariantID vid)
+{
+  dispatchTiledVariant(*this, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
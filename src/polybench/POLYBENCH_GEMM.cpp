@@ -64,11 +64,30 @@ POLYBENCH_GEMM::POLYBENCH_GEMM(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_ni * (m_nj + m_nj*m_nk) );
+  m_ni = getScaledDim(m_ni, 2);
+  m_nj = getScaledDim(m_nj, 2);
+  m_nk = getScaledDim(m_nk, 2);
+  setRunSize( m_ni * (m_nj + m_nj*m_nk) );
   setDefaultReps(run_reps);
 
   m_alpha = 0.62;
   m_beta = 1.002;
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
+
+#if defined(RUN_BATCHED)
+  if ( lsizespec == Mini || lsizespec == Small ) {
+    setVariantDefined(Base_Seq_Batched);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    setVariantDefined(Base_OpenMP_Batched);
+#endif
+  }
+#endif
 }
 
 POLYBENCH_GEMM::~POLYBENCH_GEMM() 
@@ -76,12 +95,25 @@ POLYBENCH_GEMM::~POLYBENCH_GEMM()
 
 }
 
+Index_type POLYBENCH_GEMM::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ni * m_nj +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ni * m_nk +
+         (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nk * m_nj;
+}
+
+Index_type POLYBENCH_GEMM::getFLOPsPerRep() const
+{
+  return 1 * m_ni * m_nj +
+         3 * m_ni * m_nj * m_nk;
+}
+
 void POLYBENCH_GEMM::setUp(VariantID vid)
 {
-  (void) vid;
-  allocAndInitData(m_A, m_ni * m_nk, vid);
-  allocAndInitData(m_B, m_nk * m_nj, vid);
-  allocAndInitDataConst(m_C, m_ni * m_nj, 0.0, vid);
+  const Index_type nbatch = getBatchSize(vid);
+  allocAndInitData(m_A, m_ni * m_nk * nbatch, vid);
+  allocAndInitData(m_B, m_nk * m_nj * nbatch, vid);
+  allocAndInitDataConst(m_C, m_ni * m_nj * nbatch, 0.0, vid);
 }
 
 void POLYBENCH_GEMM::runKernel(VariantID vid)
@@ -142,15 +174,15 @@ void POLYBENCH_GEMM::runKernel(VariantID vid)
           RAJA::make_tuple( RAJA::RangeSegment{0, ni},
                             RAJA::RangeSegment{0, nj},
                             RAJA::RangeSegment{0, nk} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),  // variable for dot
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),  // variable for dot
 
-          [=](Index_type i, Index_type j, Index_type /*k*/, Real_type& dot) {
+          [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type& dot) {
             POLYBENCH_GEMM_BODY1_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type k, Real_type& dot) {
+          [=](Index_type i, Index_type j, Index_type k, Accum_type& dot) {
             POLYBENCH_GEMM_BODY2_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type /*k*/, Real_type& dot) {
+          [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type& dot) {
             POLYBENCH_GEMM_BODY3_RAJA;
           }
         );
@@ -215,15 +247,15 @@ void POLYBENCH_GEMM::runKernel(VariantID vid)
           RAJA::make_tuple( RAJA::RangeSegment{0, ni},
                             RAJA::RangeSegment{0, nj},
                             RAJA::RangeSegment{0, nk} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),  // variable for dot
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),  // variable for dot
 
-          [=](Index_type i, Index_type j, Index_type /*k*/, Real_type& dot) {
+          [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type& dot) {
             POLYBENCH_GEMM_BODY1_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type k, Real_type& dot) {
+          [=](Index_type i, Index_type j, Index_type k, Accum_type& dot) {
             POLYBENCH_GEMM_BODY2_RAJA;
           },
-          [=](Index_type i, Index_type j, Index_type /*k*/, Real_type& dot) {
+          [=](Index_type i, Index_type j, Index_type /*k*/, Accum_type& dot) {
             POLYBENCH_GEMM_BODY3_RAJA;
           }
         );
@@ -235,6 +267,28 @@ void POLYBENCH_GEMM::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
+#if defined(RUN_BATCHED)
+    case Base_Seq_Batched :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Batched :
+#endif
+    {
+      runBatchedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
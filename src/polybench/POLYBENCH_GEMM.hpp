@@ -26,7 +26,7 @@
 
 #define POLYBENCH_GEMM_BODY1 \
   C[j + i*nj] *= beta; \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_GEMM_BODY2 \
   dot += alpha * A[k + i*nk] * B[j + k*nj];  
@@ -73,6 +73,8 @@ public:
 
   ~POLYBENCH_GEMM();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -80,6 +82,11 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+  void runBatchedVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_ni;
@@ -195,15 +195,15 @@ void POLYBENCH_GEMVER::runCudaVariant(VariantID vid)
       RAJA::kernel_param<EXEC_POL24>(
         RAJA::make_tuple(RAJA::RangeSegment{0, n},
                          RAJA::RangeSegment{0, n}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+        [=] __device__ (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
           POLYBENCH_GEMVER_BODY2_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type j, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type j, Accum_type &dot) {
           POLYBENCH_GEMVER_BODY3_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
           POLYBENCH_GEMVER_BODY4_RAJA;
         }
       );
@@ -217,15 +217,15 @@ void POLYBENCH_GEMVER::runCudaVariant(VariantID vid)
       RAJA::kernel_param<EXEC_POL24>(
         RAJA::make_tuple(RAJA::RangeSegment{0, n},
                          RAJA::RangeSegment{0, n}),
-        RAJA::make_tuple(static_cast<Real_type>(0.0)),
+        RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-        [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
           POLYBENCH_GEMVER_BODY6_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type j, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type j, Accum_type &dot) {
           POLYBENCH_GEMVER_BODY7_RAJA;
         },
-        [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+        [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
           POLYBENCH_GEMVER_BODY8_RAJA;
         }
       );
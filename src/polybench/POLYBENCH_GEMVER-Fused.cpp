@@ -0,0 +1,315 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMVER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_FUSED)
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_GEMVER_DATA_SETUP_FUSED \
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+  ResReal_ptr A = m_A; \
+  ResReal_ptr u1 = m_u1; \
+  ResReal_ptr v1 = m_v1; \
+  ResReal_ptr u2 = m_u2; \
+  ResReal_ptr v2 = m_v2; \
+  ResReal_ptr w = m_w; \
+  ResReal_ptr x = m_x; \
+  ResReal_ptr y = m_y; \
+  ResReal_ptr z = m_z;
+
+//
+// Update of row r of A (BODY1) is fused with the transposed product that 
+// reads it (BODY3): the dot product for each x[c] is accumulated in xdot[c]
+// as rows of A are updated, in the same order over rows as in the unfused
+// loops, so A is read and written once in the fused loop instead of being
+// read again by column. Checksums are the same.
+//
+// In OpenMP variants, each thread updates the same columns of each row, so
+// each thread accumulates its own entries of xdot.
+//
+#define POLYBENCH_GEMVER_BODY3_FUSED \
+  xdot[c] += beta * A[c + r*n] * y[r];
+
+#define POLYBENCH_GEMVER_BODY45_FUSED \
+  x[i] += xdot[i]; \
+  x[i] += z[i];
+
+Index_type POLYBENCH_GEMVER::getFusedBytesPerRep() const
+{
+  return (3*sizeof(Real_type) + 10*sizeof(Real_type)) * m_n +
+         (1*sizeof(Real_type) + 2*sizeof(Real_type)) * m_n * m_n;
+}
+
+void POLYBENCH_GEMVER::runFusedVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type n = m_n;
+
+  POLYBENCH_GEMVER_DATA_SETUP_FUSED;
+
+  std::vector<Accum_type> xdot_vec(n, 0.0);
+  Accum_type* xdot = &xdot_vec[0];
+
+  auto poly_gemver_fused_lam1 = [=](Index_type r, Index_type c) {
+                                  const Index_type i = r;
+                                  const Index_type j = c;
+                                  POLYBENCH_GEMVER_BODY1;
+                                };
+  auto poly_gemver_fused_lam3 = [=](Index_type r, Index_type c) {
+                                  POLYBENCH_GEMVER_BODY3_FUSED;
+                                };
+  auto poly_gemver_fused_lam45 = [=](Index_type i) {
+                                   POLYBENCH_GEMVER_BODY45_FUSED;
+                                 };
+
+  switch ( vid ) {
+
+    case Base_Seq_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < n; c++) {
+          xdot[c] = 0.0;
+        }
+
+        for (Index_type r = 0; r < n; r++ ) {
+          for (Index_type c = 0; c < n; c++) {
+            const Index_type i = r;
+            const Index_type j = c;
+            POLYBENCH_GEMVER_BODY1;
+            POLYBENCH_GEMVER_BODY3_FUSED;
+          }
+        }
+
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY45_FUSED;
+        }
+
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Fused : {
+
+      POLYBENCH_GEMVER_VIEWS_RAJA;
+
+      using EXEC_POL13 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,    // r
+            RAJA::statement::For<1, RAJA::loop_exec,  // c
+              RAJA::statement::Lambda<0>,
+              RAJA::statement::Lambda<1>
+            >
+          >
+        >;
+
+      using EXEC_POL68 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::Lambda<0>,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<1>
+            >,
+            RAJA::statement::Lambda<2>
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec> (RAJA::RangeSegment{0, n},
+          [=] (Index_type c) {
+            xdot[c] = 0.0;
+          }
+        );
+
+        RAJA::kernel<EXEC_POL13>( RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                                                   RAJA::RangeSegment{0, n}),
+          poly_gemver_fused_lam1,
+          poly_gemver_fused_lam3
+        );
+
+        RAJA::forall<RAJA::loop_exec> (RAJA::RangeSegment{0, n},
+          poly_gemver_fused_lam45
+        );
+
+        RAJA::kernel_param<EXEC_POL68>(
+          RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                           RAJA::RangeSegment{0, n}),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
+
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
+            POLYBENCH_GEMVER_BODY6_RAJA;
+          },
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
+            POLYBENCH_GEMVER_BODY7_RAJA;
+          },
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
+            POLYBENCH_GEMVER_BODY8_RAJA;
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type c = 0; c < n; c++) {
+            xdot[c] = 0.0;
+          }
+
+          for (Index_type r = 0; r < n; r++ ) {
+            #pragma omp for schedule(static) nowait
+            for (Index_type c = 0; c < n; c++) {
+              const Index_type i = r;
+              const Index_type j = c;
+              POLYBENCH_GEMVER_BODY1;
+              POLYBENCH_GEMVER_BODY3_FUSED;
+            }
+          }
+
+          #pragma omp for schedule(static)
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY45_FUSED;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY6;
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMVER_BODY7;
+            }
+            POLYBENCH_GEMVER_BODY8;
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      POLYBENCH_GEMVER_VIEWS_RAJA;
+
+      //
+      // Each thread updates a tile of columns of every row of A.
+      //
+      using EXEC_POL13 =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<1, RAJA::statement::tile_fixed<64>,
+                                RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,    // r
+              RAJA::statement::For<1, RAJA::loop_exec,  // c
+                RAJA::statement::Lambda<0>,
+                RAJA::statement::Lambda<1>
+              >
+            >
+          >
+        >;
+
+      using EXEC_POL68 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Lambda<0>,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<1>
+            >,
+            RAJA::statement::Lambda<2>
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (RAJA::RangeSegment{0, n},
+          [=] (Index_type c) {
+            xdot[c] = 0.0;
+          }
+        );
+
+        RAJA::kernel<EXEC_POL13>( RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                                                   RAJA::RangeSegment{0, n}),
+          poly_gemver_fused_lam1,
+          poly_gemver_fused_lam3
+        );
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (RAJA::RangeSegment{0, n},
+          poly_gemver_fused_lam45
+        );
+
+        RAJA::kernel_param<EXEC_POL68>(
+          RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                           RAJA::RangeSegment{0, n}),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
+
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
+            POLYBENCH_GEMVER_BODY6_RAJA;
+          },
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
+            POLYBENCH_GEMVER_BODY7_RAJA;
+          },
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
+            POLYBENCH_GEMVER_BODY8_RAJA;
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  POLYBENCH_GEMVER : Unknown fused variant id = "
+                << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_FUSED
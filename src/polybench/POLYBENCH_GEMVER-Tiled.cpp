@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMVER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TileUtils.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_GEMVER_DATA_SETUP_TILED \
+  const Index_type n = m_n; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+  Real_ptr A = m_A; \
+  Real_ptr u1 = m_u1; \
+  Real_ptr v1 = m_v1; \
+  Real_ptr u2 = m_u2; \
+  Real_ptr v2 = m_v2; \
+  Real_ptr w = m_w; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z;
+
+
+//
+// The rank-2 update of A and w = w + alpha*A*x work on RB rows of A at a
+// time. x = x + beta*A^T*y reads RB rows of A at a time for a tile of
+// entries of x, with unit stride, as in POLYBENCH_MVT tiled variants.
+//
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+void POLYBENCH_GEMVER::runTiledVariantImpl()
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMVER_DATA_SETUP_TILED;
+
+  POLYBENCH_GEMVER_VIEWS_RAJA;
+
+  const Index_type nb = (n + RB - 1) / RB;
+
+  using EXEC_POL1 =
+    RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE/RB>, OUTER_POL,
+        RAJA::statement::Tile<1, RAJA::statement::tile_fixed<TILE>,
+                                 RAJA::loop_exec,
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+
+  using EXEC_POL2 = TiledColumnDotPolicy<TILE, OUTER_POL>;
+
+  using EXEC_POL4 = TiledRowDotPolicy<TILE, RB, OUTER_POL>;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel<EXEC_POL1>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nb},
+                       RAJA::RangeSegment{0, n}),
+
+      [=] (Index_type ib, Index_type j) {
+        const Real_type v1j = v1view(j);
+        const Real_type v2j = v2view(j);
+        forRegisterBlock<RB>(ib, n, [&](Index_type, Index_type i) {
+          Aview(i,j) += u1view(i) * v1j + u2view(i) * v2j;
+        });
+      }
+    );
+
+    RAJA::kernel_param<EXEC_POL2>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                       RAJA::RangeSegment{0, nb}),
+      RAJA::make_tuple(TileAccum<TILE>()),
+
+      [=] (Index_type /* i */, Index_type /* jb */, TileAccum<TILE> &dot) {
+        for (Index_type t = 0; t < TILE; ++t) {
+          dot.v[t] = 0.0;
+        }
+      },
+      [=] (Index_type i, Index_type jb, TileAccum<TILE> &dot) {
+        forRegisterBlock<RB>(jb, n, [&](Index_type, Index_type j) {
+          dot.v[i % TILE] += beta * Aview(j,i) * yview(j);
+        });
+      },
+      [=] (Index_type i, Index_type /* jb */, TileAccum<TILE> &dot) {
+        xview(i) += dot.v[i % TILE];
+      }
+    );
+
+    RAJA::forall<OUTER_POL> (RAJA::RangeSegment{0, n},
+      [=] (Index_type i) {
+        POLYBENCH_GEMVER_BODY5_RAJA;
+      }
+    );
+
+    RAJA::kernel_param<EXEC_POL4>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nb},
+                       RAJA::RangeSegment{0, n}),
+      RAJA::make_tuple(TileAccum<RB>()),
+
+      [=] (Index_type ib, Index_type /* j */, TileAccum<RB> &dot) {
+        forRegisterBlock<RB>(ib, n, [&](Index_type r, Index_type i) {
+          dot.v[r] = wview(i);
+        });
+      },
+      [=] (Index_type ib, Index_type j, TileAccum<RB> &dot) {
+        const Real_type xj = xview(j);
+        forRegisterBlock<RB>(ib, n, [&](Index_type r, Index_type i) {
+          dot.v[r] += alpha * Aview(i,j) * xj;
+        });
+      },
+      [=] (Index_type ib, Index_type /* j */, TileAccum<RB> &dot) {
+        forRegisterBlock<RB>(ib, n, [&](Index_type r, Index_type i) {
+          wview(i) = dot.v[r];
+        });
+      }
+    );
+
+  }
+  stopTimer();
+}
+
+void POLYBENCH_GEMVER::runTiledVariant(VariantID vid)
+{
+  dispatchTiledVariant(*this, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
@@ -66,17 +66,46 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
       break;
   }
 
-  setDefaultSize(m_n*m_n + m_n*m_n + m_n + m_n*m_n);
+  m_n = getScaledDim(m_n, 2);
+  setRunSize(m_n*m_n + m_n*m_n + m_n + m_n*m_n);
   setDefaultReps(run_reps);
 
   m_alpha = 1.5;
   m_beta = 1.2;
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
+
+#if defined(RUN_FUSED)
+  setVariantDefined(Base_Seq_Fused);
+  setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_Fused);
+  setVariantDefined(RAJA_OpenMP_Fused);
+#endif
+#endif
 }
 
 POLYBENCH_GEMVER::~POLYBENCH_GEMVER() 
 {
 }
 
+Index_type POLYBENCH_GEMVER::getBytesPerRep() const
+{
+  return (3*sizeof(Real_type) + 10*sizeof(Real_type)) * m_n +
+         (1*sizeof(Real_type) + 3*sizeof(Real_type)) * m_n * m_n;
+}
+
+Index_type POLYBENCH_GEMVER::getFLOPsPerRep() const
+{
+  return 2 * m_n +
+         10 * m_n * m_n;
+}
+
 void POLYBENCH_GEMVER::setUp(VariantID vid)
 {
   (void) vid;
@@ -181,15 +210,15 @@ void POLYBENCH_GEMVER::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>( 
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY3_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY4_RAJA;
           }                                      
         );
@@ -203,15 +232,15 @@ void POLYBENCH_GEMVER::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>( 
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY6_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY7_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY8_RAJA;
           }
         );
@@ -309,15 +338,15 @@ void POLYBENCH_GEMVER::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>(
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY3_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY4_RAJA;
           }
         );
@@ -331,15 +360,15 @@ void POLYBENCH_GEMVER::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>(
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY6_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY7_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_GEMVER_BODY8_RAJA;
           }
         );
@@ -351,6 +380,30 @@ void POLYBENCH_GEMVER::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
+#if defined(RUN_FUSED)
+    case Base_Seq_Fused :
+    case RAJA_Seq_Fused :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Fused :
+    case RAJA_OpenMP_Fused :
+#endif
+    {
+      runFusedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -41,7 +41,7 @@
   A[j + i*n] += u1[i] * v1[j] + u2[i] * v2[j];
 
 #define POLYBENCH_GEMVER_BODY2 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_GEMVER_BODY3 \
   dot +=  beta * A[i + j*n] * y[j];
@@ -53,7 +53,7 @@
   x[i] += z[i];
 
 #define POLYBENCH_GEMVER_BODY6 \
-  Real_type dot = w[i];
+  Accum_type dot = w[i];
 
 #define POLYBENCH_GEMVER_BODY7 \
   dot +=  alpha * A[j + i*n] * x[j];
@@ -123,6 +123,9 @@ public:
 
   ~POLYBENCH_GEMVER();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+  Index_type getFusedBytesPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -130,6 +133,11 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+  void runFusedVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_n;
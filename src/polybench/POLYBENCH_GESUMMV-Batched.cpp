@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GESUMMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_BATCHED)
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_GESUMMV_DATA_SETUP_BATCHED \
+  const Index_type N = m_N; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+\
+  Real_ptr xbatch = m_x; \
+  Real_ptr ybatch = m_y; \
+  Real_ptr Abatch = m_A; \
+  Real_ptr Bbatch = m_B;
+
+//
+// Instance b of a batch uses the b-th N x N matrices of arrays A and B
+// and the b-th vectors of length N of arrays x and y. Instance 0 has the
+// same data as in other variants, and checksums are computed from it.
+//
+void POLYBENCH_GESUMMV::runBatchedVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type nbatch = getBatchSize(vid);
+
+  POLYBENCH_GESUMMV_DATA_SETUP_BATCHED;
+
+  auto instance = [=](Index_type b) {
+    ResReal_ptr x = xbatch + b*N;
+    ResReal_ptr y = ybatch + b*N;
+    ResReal_ptr A = Abatch + b*N*N;
+    ResReal_ptr B = Bbatch + b*N*N;
+
+    for (Index_type i = 0; i < N; ++i ) { 
+      POLYBENCH_GESUMMV_BODY1;
+      for (Index_type j = 0; j < N; ++j ) {
+        POLYBENCH_GESUMMV_BODY2;
+      }
+      POLYBENCH_GESUMMV_BODY3;
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq_Batched : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < nbatch; ++b) {
+          instance(b);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Batched : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nbatch; ++b) {
+          instance(b);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  POLYBENCH_GESUMMV : Unknown batched variant id = "
+                << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_BATCHED
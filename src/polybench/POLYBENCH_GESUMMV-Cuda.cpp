@@ -118,19 +118,19 @@ void POLYBENCH_GESUMMV::runCudaVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple( RAJA::RangeSegment{0, N},
                             RAJA::RangeSegment{0, N} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0),
-                           static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0),
+                           static_cast<Accum_type>(0.0)),
 
-          [=] __device__ (Index_type /*i*/, Index_type /*j*/, Real_type& tmpdot,
-                                                              Real_type& ydot) {
+          [=] __device__ (Index_type /*i*/, Index_type /*j*/, Accum_type& tmpdot,
+                                                              Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY1_RAJA;
           },
-          [=] __device__ (Index_type i, Index_type j, Real_type& tmpdot,
-                                                      Real_type& ydot) {
+          [=] __device__ (Index_type i, Index_type j, Accum_type& tmpdot,
+                                                      Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY2_RAJA;
           },
-          [=] __device__ (Index_type i, Index_type /*j*/, Real_type& tmpdot,
-                                                          Real_type& ydot) {
+          [=] __device__ (Index_type i, Index_type /*j*/, Accum_type& tmpdot,
+                                                          Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY3_RAJA;
           }
         );
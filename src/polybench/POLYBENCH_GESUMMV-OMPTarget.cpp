@@ -103,19 +103,19 @@ void POLYBENCH_GESUMMV::runOpenMPTargetVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple( RAJA::RangeSegment{0, N},
                             RAJA::RangeSegment{0, N} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0),
-                           static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0),
+                           static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /*i*/, Index_type /*j*/, Real_type& tmpdot,
-                                                   Real_type& ydot) {
+          [=] (Index_type /*i*/, Index_type /*j*/, Accum_type& tmpdot,
+                                                   Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY1_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type& tmpdot,
-                                           Real_type& ydot) {
+          [=] (Index_type i, Index_type j, Accum_type& tmpdot,
+                                           Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type /*j*/, Real_type& tmpdot,
-                                               Real_type& ydot) {
+          [=] (Index_type i, Index_type /*j*/, Accum_type& tmpdot,
+                                               Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY3_RAJA;
           }
         );
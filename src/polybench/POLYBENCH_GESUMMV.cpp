@@ -63,11 +63,21 @@ POLYBENCH_GESUMMV::POLYBENCH_GESUMMV(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_N * m_N );
+  m_N = getScaledDim(m_N, 2);
+  setRunSize( m_N * m_N );
   setDefaultReps(run_reps);
 
   m_alpha = 0.62;
   m_beta = 1.002;
+
+#if defined(RUN_BATCHED)
+  if ( lsizespec == Mini || lsizespec == Small ) {
+    setVariantDefined(Base_Seq_Batched);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    setVariantDefined(Base_OpenMP_Batched);
+#endif
+  }
+#endif
 }
 
 POLYBENCH_GESUMMV::~POLYBENCH_GESUMMV() 
@@ -75,13 +85,25 @@ POLYBENCH_GESUMMV::~POLYBENCH_GESUMMV()
 
 }
 
+Index_type POLYBENCH_GESUMMV::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_N +
+         (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_N * m_N;
+}
+
+Index_type POLYBENCH_GESUMMV::getFLOPsPerRep() const
+{
+  return 3 * m_N +
+         4 * m_N * m_N;
+}
+
 void POLYBENCH_GESUMMV::setUp(VariantID vid)
 {
-  (void) vid;
-  allocAndInitData(m_x, m_N, vid);
-  allocAndInitDataConst(m_y, m_N, 0.0, vid);
-  allocAndInitData(m_A, m_N * m_N, vid);
-  allocAndInitData(m_B, m_N * m_N, vid);
+  const Index_type nbatch = getBatchSize(vid);
+  allocAndInitData(m_x, m_N * nbatch, vid);
+  allocAndInitDataConst(m_y, m_N * nbatch, 0.0, vid);
+  allocAndInitData(m_A, m_N * m_N * nbatch, vid);
+  allocAndInitData(m_B, m_N * m_N * nbatch, vid);
 }
 
 void POLYBENCH_GESUMMV::runKernel(VariantID vid)
@@ -136,19 +158,19 @@ void POLYBENCH_GESUMMV::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple( RAJA::RangeSegment{0, N},
                             RAJA::RangeSegment{0, N} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0), 
-                           static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0), 
+                           static_cast<Accum_type>(0.0)),
 
-          [=](Index_type /*i*/, Index_type /*j*/, Real_type& tmpdot,
-                                                  Real_type& ydot) {
+          [=](Index_type /*i*/, Index_type /*j*/, Accum_type& tmpdot,
+                                                  Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY1_RAJA;
           },
-          [=](Index_type i, Index_type j, Real_type& tmpdot,
-                                          Real_type& ydot) {
+          [=](Index_type i, Index_type j, Accum_type& tmpdot,
+                                          Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY2_RAJA;
           },
-          [=](Index_type i, Index_type /*j*/, Real_type& tmpdot,
-                                              Real_type& ydot) {
+          [=](Index_type i, Index_type /*j*/, Accum_type& tmpdot,
+                                              Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY3_RAJA;
           }
         );
@@ -208,19 +230,19 @@ void POLYBENCH_GESUMMV::runKernel(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple( RAJA::RangeSegment{0, N},
                             RAJA::RangeSegment{0, N} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0),
-                           static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0),
+                           static_cast<Accum_type>(0.0)),
 
-          [=](Index_type /*i*/, Index_type /*j*/, Real_type& tmpdot,
-                                                  Real_type& ydot) {
+          [=](Index_type /*i*/, Index_type /*j*/, Accum_type& tmpdot,
+                                                  Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY1_RAJA;
           },
-          [=](Index_type i, Index_type j, Real_type& tmpdot,
-                                          Real_type& ydot) {
+          [=](Index_type i, Index_type j, Accum_type& tmpdot,
+                                          Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY2_RAJA;
           },
-          [=](Index_type i, Index_type /*j*/, Real_type& tmpdot,
-                                              Real_type& ydot) {
+          [=](Index_type i, Index_type /*j*/, Accum_type& tmpdot,
+                                              Accum_type& ydot) {
             POLYBENCH_GESUMMV_BODY3_RAJA;
           }
         );
@@ -232,6 +254,17 @@ void POLYBENCH_GESUMMV::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_BATCHED)
+    case Base_Seq_Batched :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_Batched :
+#endif
+    {
+      runBatchedVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
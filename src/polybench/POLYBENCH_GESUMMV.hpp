@@ -24,8 +24,8 @@
 #define RAJAPerf_POLYBENCH_GESUMMV_HPP
 
 #define POLYBENCH_GESUMMV_BODY1 \
-  Real_type tmpdot = 0.0; \
-  Real_type ydot = 0.0;
+  Accum_type tmpdot = 0.0; \
+  Accum_type ydot = 0.0;
 
 #define POLYBENCH_GESUMMV_BODY2 \
   tmpdot += A[j + i*N] * x[j]; \
@@ -77,6 +77,8 @@ public:
 
   ~POLYBENCH_GESUMMV();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -84,6 +86,7 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runBatchedVariant(VariantID vid);
 
 private:
   Index_type m_N;
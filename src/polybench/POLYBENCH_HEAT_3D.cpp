@@ -78,14 +78,34 @@ POLYBENCH_HEAT_3D::POLYBENCH_HEAT_3D(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_tsteps * 2 * m_N * m_N * m_N);
+  m_N = getScaledDim(m_N, 3);
+  setRunSize( m_tsteps * 2 * m_N * m_N * m_N);
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(Base_Seq_TimeTiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_TimeTiled);
+#endif
+#endif
 }
 
 POLYBENCH_HEAT_3D::~POLYBENCH_HEAT_3D() 
 {
 }
 
+Index_type POLYBENCH_HEAT_3D::getBytesPerRep() const
+{
+  return m_tsteps * 2 *
+         ( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * (m_N-2) * (m_N-2) * (m_N-2) +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_N * m_N * m_N );
+}
+
+Index_type POLYBENCH_HEAT_3D::getFLOPsPerRep() const
+{
+  return m_tsteps * 2 * 15 * (m_N-2) * (m_N-2) * (m_N-2);
+}
+
 void POLYBENCH_HEAT_3D::setUp(VariantID vid)
 {
   (void) vid;
@@ -280,6 +300,17 @@ void POLYBENCH_HEAT_3D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case Base_Seq_TimeTiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_TimeTiled :
+#endif
+    {
+      runTimeTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
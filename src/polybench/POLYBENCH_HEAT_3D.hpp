@@ -103,6 +103,8 @@ public:
 
   ~POLYBENCH_HEAT_3D();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -110,6 +112,7 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTimeTiledVariant(VariantID vid);
 
 private:
   Index_type m_N;
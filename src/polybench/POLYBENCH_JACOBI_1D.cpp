@@ -67,8 +67,16 @@ POLYBENCH_JACOBI_1D::POLYBENCH_JACOBI_1D(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_tsteps * 2 * m_N );
+  m_N = getScaledDim(m_N, 1);
+  setRunSize( m_tsteps * 2 * m_N );
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(Base_Seq_TimeTiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_TimeTiled);
+#endif
+#endif
 }
 
 POLYBENCH_JACOBI_1D::~POLYBENCH_JACOBI_1D() 
@@ -76,6 +84,18 @@ POLYBENCH_JACOBI_1D::~POLYBENCH_JACOBI_1D()
 
 }
 
+Index_type POLYBENCH_JACOBI_1D::getBytesPerRep() const
+{
+  return m_tsteps * 2 *
+         ( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * (m_N-2) +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_N );
+}
+
+Index_type POLYBENCH_JACOBI_1D::getFLOPsPerRep() const
+{
+  return m_tsteps * 2 * 3 * (m_N-2);
+}
+
 void POLYBENCH_JACOBI_1D::setUp(VariantID vid)
 {
   (void) vid;
@@ -208,6 +228,17 @@ void POLYBENCH_JACOBI_1D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case Base_Seq_TimeTiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_TimeTiled :
+#endif
+    {
+      runTimeTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -48,6 +48,8 @@ public:
 
   ~POLYBENCH_JACOBI_1D();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -55,6 +57,7 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTimeTiledVariant(VariantID vid);
 
 private:
   Index_type m_N;
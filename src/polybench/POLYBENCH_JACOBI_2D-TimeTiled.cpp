@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_JACOBI_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TimeTileUtils.hpp"
+#include "common/ThreadUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_JACOBI_2D_DATA_SETUP_TIME_TILED \
+  ResReal_ptr A = m_Ainit; \
+  ResReal_ptr B = m_Binit;
+
+#define POLYBENCH_JACOBI_2D_DATA_RESET_TIME_TILED \
+  m_Ainit = m_A; \
+  m_Binit = m_B; \
+  m_A = A; \
+  m_B = B;
+
+
+//
+// Stage 0 of each time step writes B from A and stage 1 writes A from B;
+// each reads rows i-1, i, i+1, so tiles of rows shrink by one row per
+// stage. Each row is swept over all j.
+//
+void POLYBENCH_JACOBI_2D::runTimeTiledVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+  const Index_type tsteps = m_tsteps;
+  const Index_type block_steps = run_params.getTimeBlock();
+
+  POLYBENCH_JACOBI_2D_DATA_SETUP_TIME_TILED;
+
+  auto stage = [=](Index_type /* t */, Index_type s,
+                   Index_type lo, Index_type hi) {
+    if ( s == 0 ) {
+      for (Index_type i = lo; i < hi; ++i ) {
+        for (Index_type j = 1; j < N-1; ++j ) {
+          POLYBENCH_JACOBI_2D_BODY1;
+        }
+      }
+    } else {
+      for (Index_type i = lo; i < hi; ++i ) {
+        for (Index_type j = 1; j < N-1; ++j ) {
+          POLYBENCH_JACOBI_2D_BODY2;
+        }
+      }
+    }
+  };
+
+  const SymmetricShrink<2> shrink{};
+
+  switch ( vid ) {
+
+    case Base_Seq_TimeTiled : {
+
+      const Index_type tile_rows =
+        getTimeTileRows(N-2, 2*N*sizeof(Real_type), 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forTimeTiles<false>(tsteps, 2, block_steps, 1, N-1, tile_rows,
+                            shrink, stage);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_TimeTiled : {
+
+      const Index_type tile_rows =
+        getTimeTileRows(N-2, 2*N*sizeof(Real_type), getNumThreads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forTimeTiles<true>(tsteps, 2, block_steps, 1, N-1, tile_rows,
+                           shrink, stage);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      std::cout << "\n  POLYBENCH_JACOBI_2D : Unknown time-tiled variant id = "
+                << vid << std::endl;
+    }
+
+  }
+
+  POLYBENCH_JACOBI_2D_DATA_RESET_TIME_TILED;
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
@@ -67,14 +67,34 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
       break;
   }
 
-  setDefaultSize( m_tsteps * 2 * m_N * m_N );
+  m_N = getScaledDim(m_N, 2);
+  setRunSize( m_tsteps * 2 * m_N * m_N );
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(Base_Seq_TimeTiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(Base_OpenMP_TimeTiled);
+#endif
+#endif
 }
 
 POLYBENCH_JACOBI_2D::~POLYBENCH_JACOBI_2D() 
 {
 }
 
+Index_type POLYBENCH_JACOBI_2D::getBytesPerRep() const
+{
+  return m_tsteps * 2 *
+         ( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * (m_N-2) * (m_N-2) +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_N * m_N );
+}
+
+Index_type POLYBENCH_JACOBI_2D::getFLOPsPerRep() const
+{
+  return m_tsteps * 2 * 5 * (m_N-2) * (m_N-2);
+}
+
 void POLYBENCH_JACOBI_2D::setUp(VariantID vid)
 {
   (void) vid;
@@ -252,6 +272,17 @@ void POLYBENCH_JACOBI_2D::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case Base_Seq_TimeTiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case Base_OpenMP_TimeTiled :
+#endif
+    {
+      runTimeTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -67,6 +67,8 @@ public:
 
   ~POLYBENCH_JACOBI_2D();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -74,6 +76,7 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTimeTiledVariant(VariantID vid);
 
 private:
   Index_type m_N;
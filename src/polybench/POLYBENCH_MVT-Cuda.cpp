@@ -135,15 +135,15 @@ void POLYBENCH_MVT::runCudaVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] __device__ (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+          [=] __device__ (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY1_RAJA;
           },
-          [=] __device__ (Index_type i, Index_type j, Real_type &dot) {
+          [=] __device__ (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_MVT_BODY2_RAJA;
           },
-          [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY3_RAJA;
           }
 
@@ -152,15 +152,15 @@ void POLYBENCH_MVT::runCudaVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] __device__ (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+          [=] __device__ (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY4_RAJA;
           },
-          [=] __device__ (Index_type i, Index_type j, Real_type &dot) {
+          [=] __device__ (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_MVT_BODY5_RAJA;
           },
-          [=] __device__ (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] __device__ (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY6_RAJA;
           }
 
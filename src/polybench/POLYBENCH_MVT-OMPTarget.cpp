@@ -115,15 +115,15 @@ void POLYBENCH_MVT::runOpenMPTargetVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY1_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_MVT_BODY2_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY3_RAJA;
           }
 
@@ -132,15 +132,15 @@ void POLYBENCH_MVT::runOpenMPTargetVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::make_tuple(static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-          [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY4_RAJA;
           },
-          [=] (Index_type i, Index_type j, Real_type &dot) {
+          [=] (Index_type i, Index_type j, Accum_type &dot) {
             POLYBENCH_MVT_BODY5_RAJA;
           },
-          [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+          [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
             POLYBENCH_MVT_BODY6_RAJA;
           }
 
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-19, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_MVT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_TILED)
+
+#include "common/TileUtils.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_MVT_DATA_SETUP_TILED \
+  const Index_type N = m_N; \
+\
+  Real_ptr x1 = m_x1; \
+  Real_ptr x2 = m_x2; \
+  Real_ptr y1 = m_y1; \
+  Real_ptr y2 = m_y2; \
+  Real_ptr A = m_A;
+
+
+//
+// x1 is computed for RB rows of A at a time. The second product reads A
+// by columns in other variants; here, it reads RB rows of A at a time
+// for a tile of entries of x2, with unit stride.
+//
+template <Index_type TILE, Index_type RB, typename OUTER_POL>
+void POLYBENCH_MVT::runTiledVariantImpl()
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP_TILED;
+
+  POLYBENCH_MVT_VIEWS_RAJA;
+
+  const Index_type nb = (N + RB - 1) / RB;
+
+  using EXEC_POL1 = TiledRowDotPolicy<TILE, RB, OUTER_POL>;
+
+  using EXEC_POL2 = TiledColumnDotPolicy<TILE, OUTER_POL>;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel_param<EXEC_POL1>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, nb},
+                       RAJA::RangeSegment{0, N}),
+      RAJA::make_tuple(TileAccum<RB>()),
+
+      [=] (Index_type /* ib */, Index_type /* j */, TileAccum<RB> &dot) {
+        for (Index_type r = 0; r < RB; ++r) {
+          dot.v[r] = 0.0;
+        }
+      },
+      [=] (Index_type ib, Index_type j, TileAccum<RB> &dot) {
+        const Real_type y1j = y1view(j);
+        forRegisterBlock<RB>(ib, N, [&](Index_type r, Index_type i) {
+          dot.v[r] += Aview(i, j) * y1j;
+        });
+      },
+      [=] (Index_type ib, Index_type /* j */, TileAccum<RB> &dot) {
+        forRegisterBlock<RB>(ib, N, [&](Index_type r, Index_type i) {
+          x1view(i) += dot.v[r];
+        });
+      }
+    );
+
+    RAJA::kernel_param<EXEC_POL2>(
+      RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                       RAJA::RangeSegment{0, nb}),
+      RAJA::make_tuple(TileAccum<TILE>()),
+
+      [=] (Index_type /* i */, Index_type /* jb */, TileAccum<TILE> &dot) {
+        for (Index_type t = 0; t < TILE; ++t) {
+          dot.v[t] = 0.0;
+        }
+      },
+      [=] (Index_type i, Index_type jb, TileAccum<TILE> &dot) {
+        const Real_type y2i = y2view(i);
+        forRegisterBlock<RB>(jb, N, [&](Index_type, Index_type j) {
+          dot.v[i % TILE] += Aview(j, i) * y2i;
+        });
+      },
+      [=] (Index_type i, Index_type /* jb */, TileAccum<TILE> &dot) {
+        x2view(i) += dot.v[i % TILE];
+      }
+    );
+
+  }
+  stopTimer();
+}
+
+void POLYBENCH_MVT::runTiledVariant(VariantID vid)
+{
+  dispatchTiledVariant(*this, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RUN_TILED
@@ -59,8 +59,16 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
       break;
   }
 
-  setDefaultSize( 2*m_N*m_N );
+  m_N = getScaledDim(m_N, 2);
+  setRunSize( 2*m_N*m_N );
   setDefaultReps(run_reps);
+
+#if defined(RUN_TILED)
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+#endif
 }
 
 POLYBENCH_MVT::~POLYBENCH_MVT() 
@@ -68,6 +76,18 @@ POLYBENCH_MVT::~POLYBENCH_MVT()
 
 }
 
+Index_type POLYBENCH_MVT::getBytesPerRep() const
+{
+  return (2*sizeof(Real_type) + 4*sizeof(Real_type)) * m_N +
+         (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_N * m_N;
+}
+
+Index_type POLYBENCH_MVT::getFLOPsPerRep() const
+{
+  return 2 * m_N +
+         4 * m_N * m_N;
+}
+
 void POLYBENCH_MVT::setUp(VariantID vid)
 {
   (void) vid;
@@ -141,15 +161,15 @@ void POLYBENCH_MVT::runKernel(VariantID vid)
           RAJA::kernel_param<EXEC_POL>( 
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::make_tuple(static_cast<Real_type>(0.0)),
+            RAJA::make_tuple(static_cast<Accum_type>(0.0)),
   
-            [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY1_RAJA;
             },
-            [=] (Index_type i, Index_type j, Real_type &dot) {
+            [=] (Index_type i, Index_type j, Accum_type &dot) {
               POLYBENCH_MVT_BODY2_RAJA;
             },
-            [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY3_RAJA;
             }
  
@@ -158,15 +178,15 @@ void POLYBENCH_MVT::runKernel(VariantID vid)
           RAJA::kernel_param<EXEC_POL>( 
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::make_tuple(static_cast<Real_type>(0.0)),
+            RAJA::make_tuple(static_cast<Accum_type>(0.0)),
   
-            [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY4_RAJA;
             },
-            [=] (Index_type i, Index_type j, Real_type &dot) {
+            [=] (Index_type i, Index_type j, Accum_type &dot) {
               POLYBENCH_MVT_BODY5_RAJA;
             },
-            [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY6_RAJA;
             }
  
@@ -245,15 +265,15 @@ void POLYBENCH_MVT::runKernel(VariantID vid)
           RAJA::kernel_param<EXEC_POL>(
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::make_tuple(static_cast<Real_type>(0.0)),
+            RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-            [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY1_RAJA;
             },
-            [=] (Index_type i, Index_type j, Real_type &dot) {
+            [=] (Index_type i, Index_type j, Accum_type &dot) {
               POLYBENCH_MVT_BODY2_RAJA;
             },
-            [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY3_RAJA;
             }
 
@@ -262,15 +282,15 @@ void POLYBENCH_MVT::runKernel(VariantID vid)
           RAJA::kernel_param<EXEC_POL>(
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::make_tuple(static_cast<Real_type>(0.0)),
+            RAJA::make_tuple(static_cast<Accum_type>(0.0)),
 
-            [=] (Index_type /* i */, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type /* i */, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY4_RAJA;
             },
-            [=] (Index_type i, Index_type j, Real_type &dot) {
+            [=] (Index_type i, Index_type j, Accum_type &dot) {
               POLYBENCH_MVT_BODY5_RAJA;
             },
-            [=] (Index_type i, Index_type /* j */, Real_type &dot) {
+            [=] (Index_type i, Index_type /* j */, Accum_type &dot) {
               POLYBENCH_MVT_BODY6_RAJA;
             }
 
@@ -285,6 +305,17 @@ void POLYBENCH_MVT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_TILED)
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+    {
+      runTiledVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -25,7 +25,7 @@
 #define RAJAPerf_POLYBENCH_MVT_HPP
 
 #define POLYBENCH_MVT_BODY1 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_MVT_BODY2 \
   dot += A[j + i*N] * y1[j];
@@ -34,7 +34,7 @@
   x1[i] += dot;
 
 #define POLYBENCH_MVT_BODY4 \
-  Real_type dot = 0.0;
+  Accum_type dot = 0.0;
 
 #define POLYBENCH_MVT_BODY5 \
   dot += A[i + j*N] * y2[i];
@@ -94,6 +94,8 @@ public:
 
   ~POLYBENCH_MVT();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -101,6 +103,10 @@ public:
   void tearDown(VariantID vid);
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runTiledVariant(VariantID vid);
+
+  template <Index_type TILE, Index_type RB, typename OUTER_POL>
+  void runTiledVariantImpl();
 
 private:
   Index_type m_N;
@@ -31,12 +31,26 @@ ADD::ADD(const RunParams& params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1000);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 ADD::~ADD() 
 {
 }
 
+Index_type ADD::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type ADD::getFLOPsPerRep() const
+{
+  return 1 * getRunSize();
+}
+
 void ADD::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
@@ -127,6 +141,14 @@ void ADD::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget : 
     case RAJA_OpenMPTarget :
@@ -30,12 +30,26 @@ COPY::COPY(const RunParams& params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1800);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 COPY::~COPY() 
 {
 }
 
+Index_type COPY::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type COPY::getFLOPsPerRep() const
+{
+  return 0;
+}
+
 void COPY::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
@@ -125,6 +139,14 @@ void COPY::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
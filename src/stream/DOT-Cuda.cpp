@@ -116,14 +116,14 @@ void DOT::runCudaVariant(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> dot(m_dot_init);
+       RAJA::ReduceSum<RAJA::cuda_reduce, Accum_type> dot(m_dot_init);
 
        RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          DOT_BODY;
        });
 
-       m_dot += static_cast<Real_type>(dot.get());
+       m_dot += static_cast<Accum_type>(dot.get());
 
     }
     stopTimer();
@@ -53,7 +53,7 @@ void DOT::runOpenMPTargetVariant(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      Real_type dot = m_dot_init;
+      Accum_type dot = m_dot_init;
 
       #pragma omp target is_device_ptr(a, b) device( did ) map(tofrom:dot)
       #pragma omp teams distribute parallel for reduction(+:dot) \
@@ -76,14 +76,14 @@ void DOT::runOpenMPTargetVariant(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::omp_target_reduce, Real_type> dot(m_dot_init);
+      RAJA::ReduceSum<RAJA::omp_target_reduce, Accum_type> dot(m_dot_init);
 
       RAJA::forall<RAJA::policy::omp::omp_target_parallel_for_exec<threads_per_team>>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
         DOT_BODY;
       });
 
-      m_dot += static_cast<Real_type>(dot.get());
+      m_dot += static_cast<Accum_type>(dot.get());
 
     }
     stopTimer();
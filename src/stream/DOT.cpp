@@ -30,12 +30,26 @@ DOT::DOT(const RunParams& params)
 {
    setDefaultSize(1000000);
    setDefaultReps(2000);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 DOT::~DOT() 
 {
 }
 
+Index_type DOT::getBytesPerRep() const
+{
+  return (0*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type DOT::getFLOPsPerRep() const
+{
+  return 2 * getRunSize();
+}
+
 void DOT::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
@@ -60,7 +74,7 @@ void DOT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Accum_type dot = m_dot_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           DOT_BODY;
@@ -82,14 +96,14 @@ void DOT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Accum_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::loop_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           DOT_BODY;
         });
 
-        m_dot += static_cast<Real_type>(dot.get());
+        m_dot += static_cast<Accum_type>(dot.get());
 
       }
       stopTimer();
@@ -106,7 +120,7 @@ void DOT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Accum_type dot = m_dot_init;
 
         #pragma omp parallel for reduction(+:dot)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -128,7 +142,7 @@ void DOT::runKernel(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Accum_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
@@ -144,6 +158,14 @@ void DOT::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -39,6 +39,9 @@ public:
 
   ~DOT();
 
+  Index_type getBytesPerRep() const;
+  Index_type getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -46,11 +49,12 @@ public:
 
   void runCudaVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
+  void runStdParVariant(VariantID vid);
 
 private:
   Real_ptr m_a;
   Real_ptr m_b;
-  Real_type m_dot;
+  Accum_type m_dot;
   Real_type m_dot_init;
 };
 
@@ -31,6 +31,10 @@ MUL::MUL(const RunParams& params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1800);
+
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 MUL::~MUL() 
@@ -38,6 +42,16 @@ MUL::~MUL()
 
 }
 
+Index_type MUL::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type MUL::getFLOPsPerRep() const
+{
+  return 1 * getRunSize();
+}
+
 void MUL::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_b, getRunSize(), 0.0, vid);
@@ -128,6 +142,14 @@ void MUL::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SIMDUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #include <iostream>
 
@@ -26,18 +28,43 @@ namespace stream
   ResReal_ptr c = m_c; \
   Real_type alpha = m_alpha;
 
+#define TRIAD_DATA_SETUP_SIMD \
+  const SIMDReal valpha = simdSet1(alpha);
+
 
 TRIAD::TRIAD(const RunParams& params)
   : KernelBase(rajaperf::Stream_TRIAD, params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1000);
+
+#if defined(RUN_SIMD)
+   setVariantDefined(Base_SIMD);
+   setVariantDefined(RAJA_SIMD);
+#endif
+#if defined(RUN_THREADPOOL)
+   setVariantDefined(Base_ThreadPool);
+   setVariantDefined(Lambda_ThreadPool);
+#endif
+#if defined(RUN_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
 }
 
 TRIAD::~TRIAD() 
 {
 }
 
+Index_type TRIAD::getBytesPerRep() const
+{
+  return (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getRunSize();
+}
+
+Index_type TRIAD::getFLOPsPerRep() const
+{
+  return 2 * getRunSize();
+}
+
 void TRIAD::setUp(VariantID vid)
 {
   allocAndInitDataConst(m_a, getRunSize(), 0.0, vid);
@@ -91,6 +118,48 @@ void TRIAD::runKernel(VariantID vid)
     }
 #endif // RUN_RAJA_SEQ
 
+#if defined(RUN_SIMD)
+    case Base_SIMD : {
+
+      TRIAD_DATA_SETUP_CPU;
+      TRIAD_DATA_SETUP_SIMD;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          TRIAD_BODY_SIMD;
+        }
+        for ( ; i < iend; ++i ) {
+          TRIAD_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      TRIAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRIAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_SIMD
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)                        
     case Base_OpenMP : {
 
@@ -129,6 +198,53 @@ void TRIAD::runKernel(VariantID vid)
     }
 #endif
 
+#if defined(RUN_THREADPOOL)
+    case Base_ThreadPool : {
+
+      TRIAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForallChunks(ibegin, iend,
+          [=](Index_type ib, Index_type ie) {
+          for (Index_type i = ib; i < ie; ++i ) {
+            TRIAD_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      TRIAD_DATA_SETUP_CPU;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadPoolForall(ibegin, iend, [=](Index_type i) {
+          TRIAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_THREADPOOL
+
+#if defined(RUN_STDPAR)
+    case Base_StdPar :
+    {
+      runStdParVariant(vid);
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     case Base_OpenMPTarget :
     case RAJA_OpenMPTarget :